@@ -0,0 +1,245 @@
+#include "BenchmarkReport.hpp"
+
+#include "Utils/PreDefine.hpp"
+#include "Utils/StringFormat/StringFormat.hpp"
+
+#if defined(PROGRAM_SYSTEM_WINDOWS)
+#include <windows.h>
+#include <psapi.h>
+#elif defined(PROGRAM_SYSTEM_UNIX)
+#include <sys/resource.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <numeric>
+
+namespace Benchmark
+{
+
+namespace Detail
+{
+
+namespace Constant
+{
+
+constexpr double millisecondsPerSecond{1000.0};
+
+} // namespace Constant
+
+std::string escape(const std::string &text);
+
+std::string escape(const std::string &text)
+{
+    std::string escaped;
+    escaped.reserve(text.size());
+    for (auto c : text)
+    {
+        if (c == '"' || c == '\\')
+        {
+            escaped.push_back('\\');
+        }
+        escaped.push_back(c);
+    }
+
+    return escaped;
+}
+
+} // namespace Detail
+
+BenchmarkReport::BenchmarkReport(const std::string &path,
+                                 const std::string &scene)
+    : path_{path}, scene_{scene}, loadTime_{0.0}, frameTimes_{}, drawCalls_{},
+      gpuTimes_{}, hitchThreshold_{0.0}, bucketWidth_{0.0}, bucketCount_{0}
+{
+}
+
+void BenchmarkReport::setLoadTime(double seconds) noexcept
+{
+    loadTime_ = seconds;
+}
+
+void BenchmarkReport::addFrame(double seconds, size_t drawCalls)
+{
+    frameTimes_.push_back(seconds);
+    drawCalls_.push_back(drawCalls);
+}
+
+void BenchmarkReport::addGpuTime(const std::string &scope, double milliseconds)
+{
+    auto it{gpuTimes_.emplace(scope, GpuTime{0.0, 0.0, 0}).first};
+    it->second.total += milliseconds;
+    it->second.max = std::max(it->second.max, milliseconds);
+    ++it->second.count;
+}
+
+void BenchmarkReport::setFrameStatistics(
+    const TimeFrame::FrameStatistics &statistics)
+{
+    hitchThreshold_ = statistics.hitchThreshold();
+    bucketWidth_ = statistics.bucketWidth();
+    bucketCount_ = statistics.histogram().size();
+}
+
+size_t BenchmarkReport::frameCount() const noexcept
+{
+    return frameTimes_.size();
+}
+
+std::string BenchmarkReport::toJson() const
+{
+    using Detail::Constant::millisecondsPerSecond;
+    using TimeFrame::FrameStatistics;
+
+    auto sorted{frameTimes_};
+    std::sort(sorted.begin(), sorted.end());
+
+    const auto count{static_cast<double>(std::max(sorted.size(), size_t{1}))};
+    const auto total{std::accumulate(sorted.begin(), sorted.end(), 0.0)};
+    const auto mean{total / count};
+    auto variance{0.0};
+    for (auto time : sorted)
+    {
+        variance += (time - mean) * (time - mean);
+    }
+    variance /= count;
+
+    const auto drawCalls{
+        std::accumulate(drawCalls_.begin(), drawCalls_.end(), size_t{0})};
+    const auto maxDrawCalls{
+        drawCalls_.empty()
+            ? size_t{0}
+            : *std::max_element(drawCalls_.begin(), drawCalls_.end())};
+
+    std::string json;
+    json += "{\n";
+    json += StringFormat::StringFormat("  \"path\": \"%s\",\n",
+                                       Detail::escape(path_).c_str());
+    json += StringFormat::StringFormat("  \"scene\": \"%s\",\n",
+                                       Detail::escape(scene_).c_str());
+    json += StringFormat::StringFormat("  \"frames\": %zu,\n", sorted.size());
+    json += StringFormat::StringFormat("  \"loadTimeMs\": %.3f,\n",
+                                       loadTime_ * millisecondsPerSecond);
+    json += StringFormat::StringFormat("  \"totalTimeMs\": %.3f,\n",
+                                       total * millisecondsPerSecond);
+    json += "  \"frameTimeMs\": {\n";
+    json += StringFormat::StringFormat(
+        "    \"min\": %.4f,\n    \"max\": %.4f,\n    \"mean\": %.4f,\n"
+        "    \"stddev\": %.4f,\n",
+        (sorted.empty() ? 0.0 : sorted.front()) * millisecondsPerSecond,
+        (sorted.empty() ? 0.0 : sorted.back()) * millisecondsPerSecond,
+        mean * millisecondsPerSecond,
+        std::sqrt(variance) * millisecondsPerSecond);
+    json += StringFormat::StringFormat(
+        "    \"p50\": %.4f,\n    \"p90\": %.4f,\n    \"p95\": %.4f,\n"
+        "    \"p99\": %.4f\n",
+        FrameStatistics::percentile(sorted, 50.0) * millisecondsPerSecond,
+        FrameStatistics::percentile(sorted, 90.0) * millisecondsPerSecond,
+        FrameStatistics::percentile(sorted, 95.0) * millisecondsPerSecond,
+        FrameStatistics::percentile(sorted, 99.0) * millisecondsPerSecond);
+    json += "  },\n";
+    if (bucketCount_ && bucketWidth_ > 0.0)
+    {
+        // Counted here from every measured frame, like the percentiles.
+        std::vector<size_t> histogram(bucketCount_, 0);
+        size_t hitchCount{0};
+        for (auto time : frameTimes_)
+        {
+            ++histogram[FrameStatistics::bucketOf(time, bucketWidth_,
+                                                  bucketCount_)];
+            if (time > hitchThreshold_)
+            {
+                ++hitchCount;
+            }
+        }
+
+        json += StringFormat::StringFormat(
+            "  \"hitches\": {\n    \"thresholdMs\": %.3f,\n"
+            "    \"count\": %zu\n  },\n",
+            hitchThreshold_ * millisecondsPerSecond, hitchCount);
+        json += StringFormat::StringFormat(
+            "  \"histogram\": {\n    \"bucketWidthMs\": %.3f,\n"
+            "    \"counts\": [",
+            bucketWidth_ * millisecondsPerSecond);
+        for (size_t i{0}; i < histogram.size(); ++i)
+        {
+            json += StringFormat::StringFormat("%s%zu", i ? ", " : "",
+                                               histogram[i]);
+        }
+        json += "]\n  },\n";
+    }
+    json += StringFormat::StringFormat(
+        "  \"drawCalls\": {\n    \"total\": %zu,\n    \"mean\": %.2f,\n"
+        "    \"max\": %zu\n  },\n",
+        drawCalls, static_cast<double>(drawCalls) / count, maxDrawCalls);
+    json += StringFormat::StringFormat("  \"peakMemoryBytes\": %zu,\n",
+                                       peakMemory());
+
+    json += "  \"gpuTimeMs\": {";
+    for (auto it{gpuTimes_.begin()}; it != gpuTimes_.end(); ++it)
+    {
+        const auto &time{it->second};
+        json += StringFormat::StringFormat(
+            "%s\n    \"%s\": {\"mean\": %.4f, \"max\": %.4f, "
+            "\"samples\": %zu}",
+            it == gpuTimes_.begin() ? "" : ",",
+            Detail::escape(it->first).c_str(),
+            time.total / static_cast<double>(time.count), time.max,
+            time.count);
+    }
+    json += gpuTimes_.empty() ? "},\n" : "\n  },\n";
+
+    json += "  \"frameTimesMs\": [";
+    for (size_t i{0}; i < frameTimes_.size(); ++i)
+    {
+        json += StringFormat::StringFormat(
+            "%s%.4f", i ? ", " : "", frameTimes_[i] * millisecondsPerSecond);
+    }
+    json += "]\n}\n";
+
+    return json;
+}
+
+bool BenchmarkReport::writeToFile(const char *fileName) const
+{
+    std::ofstream file{fileName, std::ios::out | std::ios::trunc};
+    if (!file)
+    {
+        return false;
+    }
+
+    file << toJson();
+
+    return static_cast<bool>(file);
+}
+
+size_t BenchmarkReport::peakMemory()
+{
+#if defined(PROGRAM_SYSTEM_WINDOWS)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters,
+                              sizeof(counters)))
+    {
+        return 0;
+    }
+
+    return counters.PeakWorkingSetSize;
+#elif defined(PROGRAM_SYSTEM_UNIX)
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        return 0;
+    }
+
+#if defined(PROGRAM_SYSTEM_MACOS)
+    return static_cast<size_t>(usage.ru_maxrss); // In bytes.
+#else
+    return static_cast<size_t>(usage.ru_maxrss) * 1024; // In kilobytes.
+#endif
+#else
+    return 0;
+#endif
+}
+
+} // namespace Benchmark
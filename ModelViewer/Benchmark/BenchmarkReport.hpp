@@ -0,0 +1,122 @@
+#ifndef MODELVIEWER_BENCHMARK_BENCHMARKREPORT_HPP_
+#define MODELVIEWER_BENCHMARK_BENCHMARKREPORT_HPP_
+
+#include "TimeFrame/FrameStatistics.hpp"
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace Benchmark
+{
+
+/**
+ * \brief This class collects the measurements of a benchmark run and writes
+ * them as JSON.
+ *
+ * \details The report holds the time and the draw calls of every measured
+ * frame, the distribution of the frame times, the GPU time of the profiler
+ * scopes, the hitches and the histogram of the frame times, the load time of
+ * the scene and the peak resident memory of the process. Every frame time is
+ * kept, so two reports of the same path can be compared frame by frame, and
+ * every statistic covers all the measured frames.
+ */
+class BenchmarkReport
+{
+public:
+    /**
+     * \brief Initializes a new instance of the BenchmarkReport class.
+     *
+     * \param path Name of the camera path file.
+     * \param scene Name of the scene, e.g. the model file.
+     */
+    explicit BenchmarkReport(const std::string &path,
+                             const std::string &scene);
+
+    /**
+     * \brief Sets the time to load the scene.
+     *
+     * \param seconds Load time in seconds.
+     */
+    void setLoadTime(double seconds) noexcept;
+
+    /**
+     * \brief Add a measured frame.
+     *
+     * \param seconds Frame time in seconds.
+     * \param drawCalls Draw calls issued in the frame.
+     */
+    void addFrame(double seconds, size_t drawCalls);
+
+    /**
+     * \brief Add a GPU time sample of a profiler scope.
+     *
+     * \param scope Name of the scope.
+     * \param milliseconds GPU time in milliseconds.
+     */
+    void addGpuTime(const std::string &scope, double milliseconds);
+
+    /**
+     * \brief Copy the hitch threshold and the histogram buckets of
+     * \p statistics. The hitches and the histogram are counted from the
+     * measured frames of the report, not from the ring of \p statistics,
+     * which may hold fewer frames.
+     *
+     * \param statistics Specified frame statistics.
+     */
+    void setFrameStatistics(const TimeFrame::FrameStatistics &statistics);
+
+    /**
+     * \brief Gets the number of measured frames added so far.
+     *
+     * \return Requested value.
+     */
+    size_t frameCount() const noexcept;
+
+    /**
+     * \brief Gets the report as JSON.
+     *
+     * \return Requested value.
+     */
+    std::string toJson() const;
+
+    /**
+     * \brief Write the report as JSON to \p fileName.
+     *
+     * \param fileName Specified file name.
+     * \return Return \c true if the file is written. Otherwise, return
+     * \c false.
+     */
+    bool writeToFile(const char *fileName) const;
+
+    /**
+     * \brief Gets the peak resident memory of the process so far.
+     *
+     * \return Requested value in bytes, or 0 if the platform has no way to
+     * query it.
+     */
+    static size_t peakMemory();
+
+private:
+    struct GpuTime
+    {
+        double total;
+        double max;
+        size_t count;
+    };
+
+    std::string path_;
+    std::string scene_;
+    double loadTime_;
+    std::vector<double> frameTimes_;
+    std::vector<size_t> drawCalls_;
+    std::map<std::string, GpuTime> gpuTimes_;
+    double hitchThreshold_;
+    double bucketWidth_;
+    size_t bucketCount_;
+};
+
+} // namespace Benchmark
+
+#endif // MODELVIEWER_BENCHMARK_BENCHMARKREPORT_HPP_
@@ -0,0 +1,195 @@
+#include "CameraPath.hpp"
+
+#include "FileIO/FileIn.hpp"
+#include "Utils/StringFormat/StringFormat.hpp"
+
+#include "glm/common.hpp"
+
+#include <algorithm>
+#include <sstream>
+
+namespace Benchmark
+{
+
+namespace Detail
+{
+
+bool parseLine(const std::string &line, CameraPath &path, std::string &error);
+
+bool parseLine(const std::string &line, CameraPath &path, std::string &error)
+{
+    std::istringstream stream{line.substr(0, line.find('#'))};
+
+    std::string command;
+    if (!(stream >> command))
+    {
+        return true; // Blank or comment only.
+    }
+
+    if (command == "frames" || command == "warmup")
+    {
+        size_t count;
+        if (!(stream >> count))
+        {
+            error = "expect a frame count after '" + command + "'";
+            return false;
+        }
+
+        if (command == "frames")
+        {
+            path.setFrameCount(count);
+        }
+        else
+        {
+            path.setWarmupFrameCount(count);
+        }
+    }
+    else if (command == "key")
+    {
+        CameraKeyframe keyframe;
+        if (!(stream >> keyframe.frame >> keyframe.position.x >>
+              keyframe.position.y >> keyframe.position.z >>
+              keyframe.lookAt.x >> keyframe.lookAt.y >> keyframe.lookAt.z))
+        {
+            error = "expect 'key frame px py pz lx ly lz'";
+            return false;
+        }
+
+        path.addKeyframe(keyframe);
+    }
+    else
+    {
+        error = "unknown command '" + command + "'";
+        return false;
+    }
+
+    std::string rest;
+    if (stream >> rest)
+    {
+        error = "unexpected '" + rest + "'";
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace Detail
+
+CameraPath::CameraPath() : keyframes_{}, frameCount_{0}, warmupFrameCount_{0}
+{
+}
+
+bool CameraPath::loadFromFile(const char *fileName, CameraPath &path,
+                              std::string &error)
+{
+    std::string text;
+    if (!FileIO::ReadFileFullText(fileName, text))
+    {
+        error = StringFormat::StringFormat("Failed to read '%s'", fileName);
+        return false;
+    }
+
+    path = CameraPath{};
+
+    std::istringstream stream{text};
+    std::string line;
+    for (size_t lineNumber{1}; std::getline(stream, line); ++lineNumber)
+    {
+        std::string reason;
+        if (!Detail::parseLine(line, path, reason))
+        {
+            error = StringFormat::StringFormat("%s:%zu: %s", fileName,
+                                               lineNumber, reason.c_str());
+            return false;
+        }
+    }
+
+    if (path.keyframes_.empty())
+    {
+        error = StringFormat::StringFormat("%s: no keyframe", fileName);
+        return false;
+    }
+
+    return true;
+}
+
+void CameraPath::addKeyframe(const CameraKeyframe &keyframe)
+{
+    auto it{std::lower_bound(keyframes_.begin(), keyframes_.end(), keyframe,
+                             [](const CameraKeyframe &lhs,
+                                const CameraKeyframe &rhs) {
+                                 return lhs.frame < rhs.frame;
+                             })};
+
+    if (it != keyframes_.end() && it->frame == keyframe.frame)
+    {
+        *it = keyframe;
+    }
+    else
+    {
+        keyframes_.insert(it, keyframe);
+    }
+}
+
+CameraKeyframe CameraPath::sample(size_t frame) const
+{
+    if (keyframes_.empty())
+    {
+        return CameraKeyframe{frame, glm::vec3{8}, glm::vec3{0}};
+    }
+
+    auto next{std::upper_bound(keyframes_.begin(), keyframes_.end(), frame,
+                               [](size_t value, const CameraKeyframe &key) {
+                                   return value < key.frame;
+                               })};
+
+    if (next == keyframes_.begin())
+    {
+        return CameraKeyframe{frame, next->position, next->lookAt};
+    }
+
+    auto previous{next - 1};
+    if (next == keyframes_.end())
+    {
+        return CameraKeyframe{frame, previous->position, previous->lookAt};
+    }
+
+    auto t{static_cast<float>(frame - previous->frame) /
+           static_cast<float>(next->frame - previous->frame)};
+
+    return CameraKeyframe{frame,
+                          glm::mix(previous->position, next->position, t),
+                          glm::mix(previous->lookAt, next->lookAt, t)};
+}
+
+void CameraPath::setFrameCount(size_t frameCount) noexcept
+{
+    frameCount_ = frameCount;
+}
+
+void CameraPath::setWarmupFrameCount(size_t frameCount) noexcept
+{
+    warmupFrameCount_ = frameCount;
+}
+
+size_t CameraPath::frameCount() const noexcept
+{
+    if (frameCount_ || keyframes_.empty())
+    {
+        return frameCount_;
+    }
+
+    return keyframes_.back().frame + 1;
+}
+
+size_t CameraPath::warmupFrameCount() const noexcept
+{
+    return warmupFrameCount_;
+}
+
+const std::vector<CameraKeyframe> &CameraPath::keyframes() const noexcept
+{
+    return keyframes_;
+}
+
+} // namespace Benchmark
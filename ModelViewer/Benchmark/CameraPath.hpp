@@ -0,0 +1,121 @@
+#ifndef MODELVIEWER_BENCHMARK_CAMERAPATH_HPP_
+#define MODELVIEWER_BENCHMARK_CAMERAPATH_HPP_
+
+#include "glm/vec3.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace Benchmark
+{
+
+/**
+ * \brief This struct represents the camera at one frame of a CameraPath.
+ */
+struct CameraKeyframe
+{
+    size_t frame;
+    glm::vec3 position;
+    glm::vec3 lookAt;
+};
+
+/**
+ * \brief This class represents a scripted camera flight for the benchmark.
+ *
+ * \details The camera is sampled by frame index, never by time, so every run
+ * of the same path renders the same frames. Between two keyframes the camera
+ * is interpolated linearly, before the first and after the last one it stays
+ * at the nearest keyframe.
+ *
+ * A path file is plain text with one command per line, \c # starts a comment:
+ * \code
+ * frames 600           # measured frames
+ * warmup 60            # frames rendered before measuring, at frame 0
+ * key 0 8 8 8 0 0 0    # frame, camera position, look at
+ * key 599 -8 4 8 0 0 0
+ * \endcode
+ * \c frames defaults to one past the last keyframe, \c warmup to 0.
+ */
+class CameraPath
+{
+public:
+    /**
+     * \brief Initializes a new instance of the CameraPath class without any
+     * keyframe, measured frame or warmup frame.
+     */
+    explicit CameraPath();
+
+    /**
+     * \brief Parse the path file \p fileName into \p path.
+     *
+     * \param fileName Specified file name.
+     * \param path Receives the path.
+     * \param error Receives the reason if the file fails to parse.
+     * \return Return \c true if the file is parsed. Otherwise, return
+     * \c false.
+     */
+    static bool loadFromFile(const char *fileName, CameraPath &path,
+                             std::string &error);
+
+    /**
+     * \brief Add a keyframe, keeping the keyframes in frame order. A keyframe
+     * at the frame of an existing one replaces it.
+     *
+     * \param keyframe Specified keyframe.
+     */
+    void addKeyframe(const CameraKeyframe &keyframe);
+
+    /**
+     * \brief Gets the camera at \p frame.
+     *
+     * \param frame Measured frame index, starting at 0.
+     * \return Requested camera. The frame member is set to \p frame.
+     */
+    CameraKeyframe sample(size_t frame) const;
+
+    /**
+     * \brief Sets the number of measured frames.
+     *
+     * \param frameCount Specified frame count.
+     */
+    void setFrameCount(size_t frameCount) noexcept;
+
+    /**
+     * \brief Sets the number of frames rendered at frame 0 before the
+     * measured frames.
+     *
+     * \param frameCount Specified frame count.
+     */
+    void setWarmupFrameCount(size_t frameCount) noexcept;
+
+    /**
+     * \brief Gets the number of measured frames.
+     *
+     * \return Requested value.
+     */
+    size_t frameCount() const noexcept;
+
+    /**
+     * \brief Gets the number of warmup frames.
+     *
+     * \return Requested value.
+     */
+    size_t warmupFrameCount() const noexcept;
+
+    /**
+     * \brief Gets the keyframes in frame order.
+     *
+     * \return Requested value.
+     */
+    const std::vector<CameraKeyframe> &keyframes() const noexcept;
+
+private:
+    std::vector<CameraKeyframe> keyframes_;
+    size_t frameCount_;
+    size_t warmupFrameCount_;
+};
+
+} // namespace Benchmark
+
+#endif // MODELVIEWER_BENCHMARK_CAMERAPATH_HPP_
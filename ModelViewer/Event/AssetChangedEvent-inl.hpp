@@ -0,0 +1,6 @@
+namespace Event
+{
+
+inline const std::string &AssetChangedEvent::path() const { return path_; }
+
+} // namespace Event
@@ -0,0 +1,21 @@
+#include "AssetChangedEvent.hpp"
+
+namespace Event
+{
+
+AssetChangedEvent::AssetChangedEvent(const std::string &path,
+                                     TimeType timestamp,
+                                     const GLFWwindow *window)
+    : Event{staticType(), timestamp, window}, path_{path}
+{
+}
+
+AssetChangedEvent::AssetChangedEvent(AssetChangedEvent &&other) noexcept =
+    default;
+
+AssetChangedEvent &
+AssetChangedEvent::operator=(AssetChangedEvent &&other) noexcept = default;
+
+AssetChangedEvent::~AssetChangedEvent() = default;
+
+} // namespace Event
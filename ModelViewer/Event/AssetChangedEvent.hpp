@@ -0,0 +1,36 @@
+#ifndef MODELVIEWER_EVENT_ASSETCHANGEDEVENT_HPP_
+#define MODELVIEWER_EVENT_ASSETCHANGEDEVENT_HPP_
+
+#include "Event.hpp"
+
+#include <string>
+
+namespace Event
+{
+
+class AssetChangedEvent : public Event
+{
+public:
+    explicit AssetChangedEvent(const std::string &path, TimeType timestamp,
+                               const GLFWwindow *window = nullptr);
+
+    AssetChangedEvent(AssetChangedEvent &&other) noexcept;
+    AssetChangedEvent &operator=(AssetChangedEvent &&other) noexcept;
+    virtual ~AssetChangedEvent() override;
+
+    AssetChangedEvent(const AssetChangedEvent &other) = delete;
+    AssetChangedEvent &operator=(const AssetChangedEvent &other) = delete;
+
+    static constexpr Type staticType() { return Type::AssetChanged; }
+
+    inline const std::string &path() const;
+
+protected:
+    std::string path_;
+};
+
+} // namespace Event
+
+#include "AssetChangedEvent-inl.hpp"
+
+#endif // MODELVIEWER_EVENT_ASSETCHANGEDEVENT_HPP_
@@ -0,0 +1,127 @@
+#include "ConcurrentEventQueue.hpp"
+
+#include <utility>
+
+namespace Event
+{
+
+namespace Detail
+{
+
+size_t roundUpToPowerOfTwo(size_t value) noexcept;
+
+size_t roundUpToPowerOfTwo(size_t value) noexcept
+{
+    size_t power{1};
+    while (power < value)
+    {
+        power <<= 1;
+    }
+
+    return power;
+}
+
+} // namespace Detail
+
+ConcurrentEventQueue::ConcurrentEventQueue(size_t capacity)
+    : slots_{std::make_unique<Slot[]>(Detail::roundUpToPowerOfTwo(capacity))},
+      mask_{Detail::roundUpToPowerOfTwo(capacity) - 1}, tail_{0}, head_{0},
+      dropped_{0}
+{
+    for (size_t i{0}; i <= mask_; ++i)
+    {
+        slots_[i].event = nullptr;
+        slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+ConcurrentEventQueue::~ConcurrentEventQueue()
+{
+    while (front())
+    {
+        pop();
+    }
+}
+
+size_t ConcurrentEventQueue::capacity() const noexcept { return mask_ + 1; }
+
+size_t ConcurrentEventQueue::droppedCount() const noexcept
+{
+    return dropped_.load(std::memory_order_relaxed);
+}
+
+bool ConcurrentEventQueue::empty() const noexcept
+{
+    return slots_[head_ & mask_].sequence.load(std::memory_order_acquire) !=
+           head_ + 1;
+}
+
+Event *ConcurrentEventQueue::front() noexcept
+{
+    auto &slot{slots_[head_ & mask_]};
+    if (slot.sequence.load(std::memory_order_acquire) != head_ + 1)
+    {
+        return nullptr;
+    }
+
+    return slot.event;
+}
+
+void ConcurrentEventQueue::pop() noexcept
+{
+    auto &slot{slots_[head_ & mask_]};
+    if (slot.sequence.load(std::memory_order_acquire) != head_ + 1)
+    {
+        return;
+    }
+
+    slot.event->~Event();
+    slot.event = nullptr;
+
+    // Free the slot for the push of the next lap.
+    slot.sequence.store(head_ + mask_ + 1, std::memory_order_release);
+    ++head_;
+}
+
+bool ConcurrentEventQueue::push(Event &&event)
+{
+    if (event.type() >= Type::Count)
+    {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    auto position{tail_.load(std::memory_order_relaxed)};
+    Slot *slot;
+    for (;;)
+    {
+        slot = &slots_[position & mask_];
+        const auto sequence{slot->sequence.load(std::memory_order_acquire)};
+
+        if (sequence == position)
+        {
+            if (tail_.compare_exchange_weak(position, position + 1,
+                                            std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (sequence < position)
+        {
+            // The consumer has not freed the slot of the last lap yet.
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        else
+        {
+            position = tail_.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->event = moveEvent(slot->storage, std::move(event));
+    slot->sequence.store(position + 1, std::memory_order_release);
+
+    return true;
+}
+
+} // namespace Event
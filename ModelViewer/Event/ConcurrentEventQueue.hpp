@@ -0,0 +1,67 @@
+#ifndef MODELVIEWER_EVENT_CONCURRENTEVENTQUEUE_HPP_
+#define MODELVIEWER_EVENT_CONCURRENTEVENTQUEUE_HPP_
+
+#include "Event.hpp"
+#include "EventStorage.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace Event
+{
+
+/*
+ * Bounded lock-free FIFO of events stored by value. Any thread may push, one
+ * thread consumes with front and pop.
+ *
+ * Every slot carries a sequence number that tells whether it is free for the
+ * push of a lap or holds its event. A producer claims a slot with one CAS on
+ * the tail, moves its event in and publishes it through the sequence. The
+ * consumer never waits: front returns nullptr if the oldest slot is not
+ * published yet, even if later ones are. When the queue is full, the pushed
+ * event is dropped and counted.
+ */
+class ConcurrentEventQueue
+{
+public:
+    // The capacity is rounded up to a power of 2.
+    explicit ConcurrentEventQueue(size_t capacity = 1024);
+    ~ConcurrentEventQueue();
+
+    ConcurrentEventQueue(const ConcurrentEventQueue &other) = delete;
+    ConcurrentEventQueue(ConcurrentEventQueue &&other) = delete;
+    ConcurrentEventQueue &operator=(const ConcurrentEventQueue &other) = delete;
+    ConcurrentEventQueue &operator=(ConcurrentEventQueue &&other) = delete;
+
+    // Move event into the queue. Return false if it was dropped.
+    bool push(Event &&event);
+
+    // Consumer only. Return nullptr if no event is published yet.
+    Event *front() noexcept;
+    // Consumer only. Pop the event returned by front.
+    void pop() noexcept;
+    // Consumer only.
+    bool empty() const noexcept;
+
+    size_t capacity() const noexcept;
+    size_t droppedCount() const noexcept;
+
+private:
+    struct Slot
+    {
+        EventStorage storage;
+        Event *event;
+        std::atomic<size_t> sequence;
+    };
+
+    std::unique_ptr<Slot[]> slots_;
+    size_t mask_;
+    std::atomic<size_t> tail_;
+    size_t head_;
+    std::atomic<size_t> dropped_;
+};
+
+} // namespace Event
+
+#endif // MODELVIEWER_EVENT_CONCURRENTEVENTQUEUE_HPP_
@@ -5,6 +5,8 @@ inline void Event::setTimestamp(Event::TimeType t) { timestamp_ = t; }
 
 inline Event::TimeType Event::timestamp() const { return timestamp_; }
 
+inline Type Event::type() const { return type_; }
+
 inline const GLFWwindow *Event::window() const { return window_; }
 
 } // namespace Event
@@ -3,8 +3,8 @@
 namespace Event
 {
 
-Event::Event(Event::TimeType timestamp, const GLFWwindow *window)
-    : window_{window}, timestamp_{timestamp}
+Event::Event(Type type, Event::TimeType timestamp, const GLFWwindow *window)
+    : window_{window}, timestamp_{timestamp}, type_{type}
 {
 }
 
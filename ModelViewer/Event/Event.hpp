@@ -1,6 +1,8 @@
 #ifndef MODELVIEWER_EVENT_EVENT_HPP_
 #define MODELVIEWER_EVENT_EVENT_HPP_
 
+#include "EventType.hpp"
+
 #include "OpenGL/OpenGLLib.hpp"
 
 namespace Event
@@ -11,7 +13,8 @@ class Event
 public:
     using TimeType = uint64_t;
 
-    explicit Event(TimeType timestamp, const GLFWwindow *window = nullptr);
+    explicit Event(Type type, TimeType timestamp,
+                   const GLFWwindow *window = nullptr);
 
     Event(Event &&other) noexcept;
     Event &operator=(Event &&other) noexcept;
@@ -20,6 +23,8 @@ public:
     Event(const Event &other) = delete;
     Event &operator=(const Event &other) = delete;
 
+    inline Type type() const;
+
     inline const GLFWwindow *window() const;
 
     inline TimeType timestamp() const;
@@ -28,6 +33,7 @@ public:
 protected:
     const GLFWwindow *window_;
     TimeType timestamp_;
+    Type type_;
 };
 
 } // namespace Event
@@ -0,0 +1,50 @@
+#include "EventDispatcher.hpp"
+
+#include "Event.hpp"
+
+namespace Event
+{
+
+EventDispatcher::EventDispatcher() : handlers_{} {}
+
+EventDispatcher::EventDispatcher(EventDispatcher &&other) noexcept = default;
+
+EventDispatcher &
+EventDispatcher::operator=(EventDispatcher &&other) noexcept = default;
+
+EventDispatcher::~EventDispatcher() = default;
+
+void EventDispatcher::clear() noexcept
+{
+    for (auto &handlers : handlers_)
+    {
+        handlers.clear();
+    }
+}
+
+bool EventDispatcher::dispatch(Event *event) const
+{
+    const auto &handlers{handlers_[static_cast<size_t>(event->type())]};
+    for (const auto &handler : handlers)
+    {
+        if (handler->handle(event))
+        {
+            break;
+        }
+    }
+
+    return !handlers.empty();
+}
+
+void EventDispatcher::subscribe(std::unique_ptr<EventHandlerBase> &&handler)
+{
+    auto &handlers{handlers_[static_cast<size_t>(handler->type())]};
+    handlers.push_back(std::move(handler));
+}
+
+size_t EventDispatcher::subscriberCount(Type type) const noexcept
+{
+    return handlers_[static_cast<size_t>(type)].size();
+}
+
+} // namespace Event
@@ -0,0 +1,57 @@
+#ifndef MODELVIEWER_EVENT_EVENTDISPATCHER_HPP_
+#define MODELVIEWER_EVENT_EVENTDISPATCHER_HPP_
+
+#include "EventHandlerBase.hpp"
+#include "EventType.hpp"
+
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace Event
+{
+
+class Event;
+
+/**
+ * \brief This class represents a table of event subscribers indexed by the
+ * event type.
+ *
+ * \details Dispatching an event costs one lookup instead of a cast per
+ * handler. The subscribers of a type are called in the order they
+ * subscribed, until one of them returns \c true.
+ */
+class EventDispatcher
+{
+public:
+    explicit EventDispatcher();
+
+    EventDispatcher(EventDispatcher &&other) noexcept;
+    EventDispatcher &operator=(EventDispatcher &&other) noexcept;
+    ~EventDispatcher();
+
+    EventDispatcher(const EventDispatcher &other) = delete;
+    EventDispatcher &operator=(const EventDispatcher &other) = delete;
+
+    void subscribe(std::unique_ptr<EventHandlerBase> &&handler);
+
+    /**
+     * \brief Call the subscribers of the type of \p event.
+     *
+     * \return Return \c false if no subscriber has the type of the event.
+     * Otherwise, return \c true.
+     */
+    bool dispatch(Event *event) const;
+
+    size_t subscriberCount(Type type) const noexcept;
+
+    void clear() noexcept;
+
+private:
+    std::array<std::vector<std::unique_ptr<EventHandlerBase>>, typeCount>
+        handlers_;
+};
+
+} // namespace Event
+
+#endif // MODELVIEWER_EVENT_EVENTDISPATCHER_HPP_
@@ -5,7 +5,7 @@ template <typename WindowType, typename EventType,
           void (WindowType::*respondFunction)(EventType *)>
 EventHandler<WindowType, EventType, respondFunction>::EventHandler(
     WindowType &window)
-    : window_{&window}
+    : EventHandlerBase{EventType::staticType()}, window_{&window}
 {
 }
 
@@ -40,11 +40,8 @@ template <typename WindowType, typename EventType,
           void (WindowType::*respondFunction)(EventType *)>
 bool EventHandler<WindowType, EventType, respondFunction>::handle(Event *event)
 {
-    if (auto e{dynamic_cast<EventType *>(event)})
-    {
-        (window_->*respondFunction)(e);
-        return true;
-    }
+    // EventDispatcher only passes the events of type(), no cast is checked.
+    (window_->*respondFunction)(static_cast<EventType *>(event));
     return false;
 }
 
@@ -3,7 +3,7 @@
 namespace Event
 {
 
-EventHandlerBase::EventHandlerBase() {}
+EventHandlerBase::EventHandlerBase(Type type) : type_{type} {}
 
 EventHandlerBase::EventHandlerBase(const EventHandlerBase &other) = default;
 
@@ -17,4 +17,6 @@ EventHandlerBase::operator=(EventHandlerBase &&other) noexcept = default;
 
 EventHandlerBase::~EventHandlerBase() = default;
 
+Type EventHandlerBase::type() const noexcept { return type_; }
+
 } // namespace Event
@@ -1,6 +1,8 @@
 #ifndef MODELVIEWER_EVENT_HANDLERBASE_HPP_
 #define MODELVIEWER_EVENT_HANDLERBASE_HPP_
 
+#include "EventType.hpp"
+
 namespace Event
 {
 
@@ -9,7 +11,7 @@ class Event;
 class EventHandlerBase
 {
 public:
-    explicit EventHandlerBase();
+    explicit EventHandlerBase(Type type);
 
     EventHandlerBase(const EventHandlerBase &other);
     EventHandlerBase(EventHandlerBase &&other) noexcept;
@@ -18,7 +20,13 @@ public:
 
     virtual ~EventHandlerBase();
 
+    // Return true to keep the event from the later subscribers.
     virtual bool handle(Event *event) = 0;
+
+    Type type() const noexcept;
+
+private:
+    Type type_;
 };
 
 } // namespace Event
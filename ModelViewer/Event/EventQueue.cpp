@@ -0,0 +1,141 @@
+#include "EventQueue.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+
+namespace Event
+{
+
+namespace Detail
+{
+
+bool isCoalescable(Type type) noexcept;
+
+bool isCoalescable(Type type) noexcept
+{
+    return type == Type::Move || type == Type::WindowResize ||
+           type == Type::FrameBufferResize;
+}
+
+} // namespace Detail
+
+EventQueue::EventQueue(size_t capacity)
+    : slots_{std::make_unique<Slot[]>(std::max(capacity, size_t{1}))},
+      capacity_{std::max(capacity, size_t{1})}, head_{0}, tail_{0},
+      barrier_{0}, dropped_{0}, coalesced_{}
+{
+}
+
+EventQueue::~EventQueue() { clear(); }
+
+size_t EventQueue::capacity() const noexcept { return capacity_; }
+
+size_t EventQueue::coalescedCount() const noexcept
+{
+    return std::accumulate(coalesced_.begin(), coalesced_.end(), size_t{0});
+}
+
+size_t EventQueue::coalescedCount(Type type) const noexcept
+{
+    return coalesced_[static_cast<size_t>(type)];
+}
+
+void EventQueue::clear() noexcept
+{
+    while (!empty())
+    {
+        pop();
+    }
+}
+
+size_t EventQueue::droppedCount() const noexcept { return dropped_; }
+
+bool EventQueue::empty() const noexcept { return head_ == tail_; }
+
+Event *EventQueue::front() noexcept
+{
+    return empty() ? nullptr : slots_[head_ % capacity_].event;
+}
+
+void EventQueue::pop() noexcept
+{
+    if (empty())
+    {
+        return;
+    }
+
+    auto &slot{slots_[head_ % capacity_]};
+    slot.event->~Event();
+    slot.event = nullptr;
+    ++head_;
+}
+
+bool EventQueue::push(Event &&event)
+{
+    if (coalesce(event))
+    {
+        return true;
+    }
+
+    if (size() == capacity_)
+    {
+        ++dropped_;
+        return false;
+    }
+
+    auto &slot{slots_[tail_ % capacity_]};
+    slot.event = moveEvent(slot.storage, std::move(event));
+    if (!slot.event)
+    {
+        ++dropped_;
+        return false;
+    }
+
+    if (!Detail::isCoalescable(slot.event->type()))
+    {
+        barrier_ = tail_ + 1;
+    }
+    ++tail_;
+
+    return true;
+}
+
+size_t EventQueue::size() const noexcept { return tail_ - head_; }
+
+bool EventQueue::coalesce(const Event &event) noexcept
+{
+    if (!Detail::isCoalescable(event.type()))
+    {
+        return false;
+    }
+
+    // At most one event per type and window is queued after the barrier.
+    for (auto i{tail_}; i > std::max(head_, barrier_); --i)
+    {
+        auto queued{slots_[(i - 1) % capacity_].event};
+        if (queued->type() != event.type() ||
+            queued->window() != event.window())
+        {
+            continue;
+        }
+
+        if (event.type() == Type::Move)
+        {
+            static_cast<MoveEvent *>(queued)->coalesce(
+                static_cast<const MoveEvent &>(event));
+        }
+        else
+        {
+            static_cast<ResizeEvent *>(queued)->coalesce(
+                static_cast<const ResizeEvent &>(event));
+        }
+
+        ++coalesced_[static_cast<size_t>(event.type())];
+        return true;
+    }
+
+    return false;
+}
+
+} // namespace Event
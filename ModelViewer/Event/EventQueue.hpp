@@ -0,0 +1,75 @@
+#ifndef MODELVIEWER_EVENT_EVENTQUEUE_HPP_
+#define MODELVIEWER_EVENT_EVENTQUEUE_HPP_
+
+#include "Event.hpp"
+#include "EventStorage.hpp"
+
+#include <array>
+#include <cstddef>
+#include <memory>
+
+namespace Event
+{
+
+/*
+ * Bounded FIFO of events stored by value, for a single thread. Every slot is
+ * big enough for any concrete event, and the type id of the event tells which
+ * one it holds. The slots are allocated once, so pushing and popping never
+ * allocate. When the queue is full, the pushed event is dropped and counted.
+ *
+ * A move or a resize is merged into the queued event of the same type and
+ * window, which keeps its old state and takes the new one, unless a key or a
+ * button event was pushed in between. Those are never merged, so the state an
+ * input sees does not change.
+ */
+class EventQueue
+{
+public:
+    explicit EventQueue(size_t capacity = 1024);
+    ~EventQueue();
+
+    EventQueue(const EventQueue &other) = delete;
+    EventQueue(EventQueue &&other) = delete;
+    EventQueue &operator=(const EventQueue &other) = delete;
+    EventQueue &operator=(EventQueue &&other) = delete;
+
+    // Move event into the queue. Return false if it was dropped.
+    bool push(Event &&event);
+
+    // Return nullptr if the queue is empty.
+    Event *front() noexcept;
+    void pop() noexcept;
+
+    void clear() noexcept;
+
+    bool empty() const noexcept;
+    size_t size() const noexcept;
+    size_t capacity() const noexcept;
+    size_t droppedCount() const noexcept;
+
+    size_t coalescedCount() const noexcept;
+    size_t coalescedCount(Type type) const noexcept;
+
+private:
+    // Return true if event was merged into a queued one.
+    bool coalesce(const Event &event) noexcept;
+
+    struct Slot
+    {
+        EventStorage storage;
+        Event *event;
+    };
+
+    std::unique_ptr<Slot[]> slots_;
+    size_t capacity_;
+    size_t head_;
+    size_t tail_;
+    // Events before it are never merged into.
+    size_t barrier_;
+    size_t dropped_;
+    std::array<size_t, typeCount> coalesced_;
+};
+
+} // namespace Event
+
+#endif // MODELVIEWER_EVENT_EVENTQUEUE_HPP_
@@ -0,0 +1,54 @@
+#include "EventStorage.hpp"
+
+#include <new>
+#include <utility>
+
+namespace Event
+{
+
+namespace Detail
+{
+
+template <typename EventType>
+Event *moveConstruct(void *storage, Event &&event);
+
+template <typename EventType>
+Event *moveConstruct(void *storage, Event &&event)
+{
+    return new (storage) EventType{std::move(static_cast<EventType &>(event))};
+}
+
+} // namespace Detail
+
+Event *moveEvent(EventStorage &storage, Event &&event)
+{
+    void *address{&storage};
+
+    switch (event.type())
+    {
+    case Type::Keyboard:
+        return Detail::moveConstruct<KeyboardEvent>(address, std::move(event));
+    case Type::Mouse:
+        return Detail::moveConstruct<MouseEvent>(address, std::move(event));
+    case Type::Move:
+        return Detail::moveConstruct<MoveEvent>(address, std::move(event));
+    case Type::WindowResize:
+        return Detail::moveConstruct<WindowResizeEvent>(address,
+                                                        std::move(event));
+    case Type::FrameBufferResize:
+        return Detail::moveConstruct<FrameBufferResizeEvent>(address,
+                                                             std::move(event));
+    case Type::LoadCompleted:
+        return Detail::moveConstruct<LoadCompletedEvent>(address,
+                                                         std::move(event));
+    case Type::AssetChanged:
+        return Detail::moveConstruct<AssetChangedEvent>(address,
+                                                        std::move(event));
+    case Type::Count:
+        break;
+    }
+
+    return nullptr;
+}
+
+} // namespace Event
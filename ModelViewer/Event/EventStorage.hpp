@@ -0,0 +1,32 @@
+#ifndef MODELVIEWER_EVENT_EVENTSTORAGE_HPP_
+#define MODELVIEWER_EVENT_EVENTSTORAGE_HPP_
+
+#include "AssetChangedEvent.hpp"
+#include "Event.hpp"
+#include "KeyboardEvent.hpp"
+#include "LoadCompletedEvent.hpp"
+#include "MouseEvent.hpp"
+#include "MoveEvent.hpp"
+#include "ResizeEvent.hpp"
+
+#include <type_traits>
+
+namespace Event
+{
+
+// Raw storage big enough for any concrete event.
+using EventStorage =
+    std::aligned_union<0, KeyboardEvent, MouseEvent, MoveEvent,
+                       WindowResizeEvent, FrameBufferResizeEvent,
+                       LoadCompletedEvent, AssetChangedEvent>::type;
+
+/*
+ * Move event into storage as its concrete type, chosen by its type id.
+ * Return the constructed event, its base may not start at the storage, or
+ * nullptr if the type is unknown.
+ */
+Event *moveEvent(EventStorage &storage, Event &&event);
+
+} // namespace Event
+
+#endif // MODELVIEWER_EVENT_EVENTSTORAGE_HPP_
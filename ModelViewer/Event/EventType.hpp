@@ -0,0 +1,30 @@
+#ifndef MODELVIEWER_EVENT_EVENTTYPE_HPP_
+#define MODELVIEWER_EVENT_EVENTTYPE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Event
+{
+
+/*
+ * Compact id of every concrete event class. EventDispatcher indexes its table
+ * with it, so keep the values dense and Count last.
+ */
+enum class Type : uint8_t
+{
+    Keyboard,
+    Mouse,
+    Move,
+    WindowResize,
+    FrameBufferResize,
+    LoadCompleted,
+    AssetChanged,
+    Count
+};
+
+constexpr size_t typeCount{static_cast<size_t>(Type::Count)};
+
+} // namespace Event
+
+#endif // MODELVIEWER_EVENT_EVENTTYPE_HPP_
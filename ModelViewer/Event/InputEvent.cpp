@@ -3,15 +3,16 @@
 namespace Event
 {
 
-InputEvent::InputEvent(TimeType timestamp, const GLFWwindow *window,
-                       int modifier)
-    : InputEvent{timestamp, window, static_cast<InputModifierFlags>(modifier)}
+InputEvent::InputEvent(Type type, TimeType timestamp,
+                       const GLFWwindow *window, int modifier)
+    : InputEvent{type, timestamp, window,
+                 static_cast<InputModifierFlags>(modifier)}
 {
 }
 
-InputEvent::InputEvent(TimeType timestamp, const GLFWwindow *window,
-                       InputModifierFlags modifier)
-    : Event{timestamp, window}, modifier_{modifier}
+InputEvent::InputEvent(Type type, TimeType timestamp,
+                       const GLFWwindow *window, InputModifierFlags modifier)
+    : Event{type, timestamp, window}, modifier_{modifier}
 {
 }
 
@@ -13,11 +13,11 @@ namespace Event
 class InputEvent : public Event
 {
 public:
-    explicit InputEvent(TimeType timestamp, const GLFWwindow *window = nullptr,
-                        int modifier = 0);
+    explicit InputEvent(Type type, TimeType timestamp,
+                        const GLFWwindow *window = nullptr, int modifier = 0);
 
     explicit InputEvent(
-        TimeType timestamp, const GLFWwindow *window = nullptr,
+        Type type, TimeType timestamp, const GLFWwindow *window = nullptr,
         InputModifierFlags modifier = InputModifierFlags::NoModifier);
 
     InputEvent(InputEvent &&other) noexcept;
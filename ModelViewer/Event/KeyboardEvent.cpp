@@ -18,8 +18,8 @@ KeyboardEvent::KeyboardEvent(int key, int action, int scanCode,
 KeyboardEvent::KeyboardEvent(KeyboardCode key, InputAction action, int scanCode,
                              TimeType timestamp, const GLFWwindow *window,
                              InputModifierFlags modifier)
-    : InputEvent{timestamp, window, modifier}, key_{key}, scanCode_{scanCode},
-      action_{action}
+    : InputEvent{staticType(), timestamp, window, modifier}, key_{key},
+      scanCode_{scanCode}, action_{action}
 {
 }
 
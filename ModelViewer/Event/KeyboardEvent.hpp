@@ -27,6 +27,8 @@ public:
     KeyboardEvent(const KeyboardEvent &other) = delete;
     KeyboardEvent &operator=(const KeyboardEvent &other) = delete;
 
+    static constexpr Type staticType() { return Type::Keyboard; }
+
     inline KeyboardCode key() const;
     inline int scanCode() const;
     inline InputAction action() const;
@@ -0,0 +1,11 @@
+namespace Event
+{
+
+inline const std::string &LoadCompletedEvent::source() const
+{
+    return source_;
+}
+
+inline bool LoadCompletedEvent::success() const { return success_; }
+
+} // namespace Event
@@ -0,0 +1,22 @@
+#include "LoadCompletedEvent.hpp"
+
+namespace Event
+{
+
+LoadCompletedEvent::LoadCompletedEvent(const std::string &source, bool success,
+                                       TimeType timestamp,
+                                       const GLFWwindow *window)
+    : Event{staticType(), timestamp, window}, source_{source},
+      success_{success}
+{
+}
+
+LoadCompletedEvent::LoadCompletedEvent(LoadCompletedEvent &&other) noexcept =
+    default;
+
+LoadCompletedEvent &
+LoadCompletedEvent::operator=(LoadCompletedEvent &&other) noexcept = default;
+
+LoadCompletedEvent::~LoadCompletedEvent() = default;
+
+} // namespace Event
@@ -0,0 +1,39 @@
+#ifndef MODELVIEWER_EVENT_LOADCOMPLETEDEVENT_HPP_
+#define MODELVIEWER_EVENT_LOADCOMPLETEDEVENT_HPP_
+
+#include "Event.hpp"
+
+#include <string>
+
+namespace Event
+{
+
+class LoadCompletedEvent : public Event
+{
+public:
+    explicit LoadCompletedEvent(const std::string &source, bool success,
+                                TimeType timestamp,
+                                const GLFWwindow *window = nullptr);
+
+    LoadCompletedEvent(LoadCompletedEvent &&other) noexcept;
+    LoadCompletedEvent &operator=(LoadCompletedEvent &&other) noexcept;
+    virtual ~LoadCompletedEvent() override;
+
+    LoadCompletedEvent(const LoadCompletedEvent &other) = delete;
+    LoadCompletedEvent &operator=(const LoadCompletedEvent &other) = delete;
+
+    static constexpr Type staticType() { return Type::LoadCompleted; }
+
+    inline const std::string &source() const;
+    inline bool success() const;
+
+protected:
+    std::string source_;
+    bool success_;
+};
+
+} // namespace Event
+
+#include "LoadCompletedEvent-inl.hpp"
+
+#endif // MODELVIEWER_EVENT_LOADCOMPLETEDEVENT_HPP_
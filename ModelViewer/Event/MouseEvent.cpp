@@ -18,8 +18,8 @@ MouseEvent::MouseEvent(int button, const PositionType &position, int action,
 MouseEvent::MouseEvent(MouseCode button, const PositionType &position,
                        InputAction action, Event::TimeType timestamp,
                        const GLFWwindow *window, InputModifierFlags modifier)
-    : InputEvent{timestamp, window, modifier}, button_{button}, action_{action},
-      position_{position}
+    : InputEvent{staticType(), timestamp, window, modifier}, button_{button},
+      action_{action}, position_{position}
 {
 }
 
@@ -31,6 +31,8 @@ public:
     MouseEvent(const MouseEvent &other) = delete;
     MouseEvent &operator=(const MouseEvent &other) = delete;
 
+    static constexpr Type staticType() { return Type::Mouse; }
+
     inline MouseCode button() const;
     inline InputAction action() const;
     inline PositionType position() const;
@@ -1,6 +1,12 @@
 namespace Event
 {
 
+inline void MoveEvent::coalesce(const MoveEvent &later)
+{
+    position_ = later.position_;
+    timestamp_ = later.timestamp_;
+}
+
 inline MoveEvent::PositionType MoveEvent::oldPosition() const
 {
     return oldPosition_;
@@ -6,7 +6,8 @@ namespace Event
 MoveEvent::MoveEvent(const PositionType &position,
                      const PositionType &oldPosition, Event::TimeType timestamp,
                      const GLFWwindow *window)
-    : Event{timestamp, window}, position_{position}, oldPosition_{oldPosition}
+    : Event{staticType(), timestamp, window}, position_{position},
+      oldPosition_{oldPosition}
 {
 }
 
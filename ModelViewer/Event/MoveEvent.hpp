@@ -21,9 +21,14 @@ public:
     MoveEvent &operator=(MoveEvent &&other) noexcept;
     virtual ~MoveEvent() override;
 
+    static constexpr Type staticType() { return Type::Move; }
+
     inline PositionType position() const;
     inline PositionType oldPosition() const;
 
+    // Take the position and the timestamp of a later move, keep oldPosition.
+    inline void coalesce(const MoveEvent &later);
+
 protected:
     PositionType position_;
     PositionType oldPosition_;
@@ -1,6 +1,12 @@
 namespace Event
 {
 
+inline void ResizeEvent::coalesce(const ResizeEvent &later)
+{
+    size_ = later.size_;
+    timestamp_ = later.timestamp_;
+}
+
 inline ResizeEvent::SizeType ResizeEvent::oldSize() const { return oldSize_; }
 
 inline ResizeEvent::SizeType ResizeEvent::size() const { return size_; }
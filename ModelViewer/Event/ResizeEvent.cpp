@@ -3,9 +3,10 @@
 namespace Event
 {
 
-ResizeEvent::ResizeEvent(const SizeType &size, const SizeType &oldSize,
-                         Event::TimeType timestamp, const GLFWwindow *window)
-    : Event{timestamp, window}, size_{size}, oldSize_{oldSize}
+ResizeEvent::ResizeEvent(Type type, const SizeType &size,
+                         const SizeType &oldSize, Event::TimeType timestamp,
+                         const GLFWwindow *window)
+    : Event{type, timestamp, window}, size_{size}, oldSize_{oldSize}
 {
 }
 
@@ -15,4 +16,20 @@ ResizeEvent &ResizeEvent::operator=(ResizeEvent &&other) noexcept = default;
 
 ResizeEvent::~ResizeEvent() = default;
 
+WindowResizeEvent::WindowResizeEvent(const SizeType &size,
+                                     const SizeType &oldSize,
+                                     TimeType timestamp,
+                                     const GLFWwindow *window)
+    : ResizeEvent{staticType(), size, oldSize, timestamp, window}
+{
+}
+
+FrameBufferResizeEvent::FrameBufferResizeEvent(const SizeType &size,
+                                               const SizeType &oldSize,
+                                               TimeType timestamp,
+                                               const GLFWwindow *window)
+    : ResizeEvent{staticType(), size, oldSize, timestamp, window}
+{
+}
+
 } // namespace Event
@@ -13,8 +13,8 @@ class ResizeEvent : public Event
 public:
     using SizeType = glm::ivec2;
 
-    explicit ResizeEvent(const SizeType &size, const SizeType &oldSize,
-                         TimeType timestamp,
+    explicit ResizeEvent(Type type, const SizeType &size,
+                         const SizeType &oldSize, TimeType timestamp,
                          const GLFWwindow *window = nullptr);
 
     ResizeEvent(ResizeEvent &&other) noexcept;
@@ -27,6 +27,9 @@ public:
     inline SizeType size() const;
     inline SizeType oldSize() const;
 
+    // Take the size and the timestamp of a later resize, keep oldSize.
+    inline void coalesce(const ResizeEvent &later);
+
 protected:
     SizeType size_;
     SizeType oldSize_;
@@ -35,12 +38,22 @@ protected:
 
 class WindowResizeEvent : public ResizeEvent
 {
-    using ResizeEvent::ResizeEvent;
+public:
+    explicit WindowResizeEvent(const SizeType &size, const SizeType &oldSize,
+                               TimeType timestamp,
+                               const GLFWwindow *window = nullptr);
+
+    static constexpr Type staticType() { return Type::WindowResize; }
 };
 
 class FrameBufferResizeEvent : public ResizeEvent
 {
-    using ResizeEvent::ResizeEvent;
+public:
+    explicit FrameBufferResizeEvent(const SizeType &size,
+                                    const SizeType &oldSize, TimeType timestamp,
+                                    const GLFWwindow *window = nullptr);
+
+    static constexpr Type staticType() { return Type::FrameBufferResize; }
 };
 
 } // namespace Event
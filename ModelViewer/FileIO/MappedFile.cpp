@@ -0,0 +1,203 @@
+#include "MappedFile.hpp"
+
+#include "Detail/Generals.hpp"
+
+#include "Utils/PreDefine.hpp"
+
+#include <fstream>
+#include <vector>
+
+#if defined(PROGRAM_SYSTEM_UNIX)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace FileIO
+{
+
+namespace Detail
+{
+
+namespace Constant
+{
+
+constexpr char emptyContent[1]{'\0'};
+
+} // namespace Constant
+
+} // namespace Detail
+
+class MappedFile::Impl
+{
+public:
+    explicit Impl();
+    ~Impl();
+
+    Impl(Impl &&other) noexcept = delete;
+    Impl &operator=(Impl &&other) noexcept = delete;
+    Impl(const Impl &other) = delete;
+    Impl &operator=(const Impl &other) = delete;
+
+    bool open(const char *fileName);
+    void close() noexcept;
+
+    bool isOpen() const noexcept;
+
+    const char *data() const noexcept;
+    size_t size() const noexcept;
+
+private:
+    bool map(const char *fileName);
+    bool read(const char *fileName);
+
+    const char *data_;
+    size_t size_;
+    bool mapped_;
+    std::vector<char> buffer_;
+};
+
+MappedFile::MappedFile() : pimpl_{std::make_unique<Impl>()} {}
+
+MappedFile::MappedFile(const char *fileName) : MappedFile()
+{
+    pimpl_->open(fileName);
+}
+
+MappedFile::MappedFile(MappedFile &&other) noexcept = default;
+
+MappedFile &MappedFile::operator=(MappedFile &&other) noexcept = default;
+
+MappedFile::~MappedFile() = default;
+
+bool MappedFile::open(const char *fileName)
+{
+    if (!pimpl_)
+    {
+        pimpl_ = std::make_unique<Impl>();
+    }
+
+    return pimpl_->open(fileName);
+}
+
+void MappedFile::close() noexcept
+{
+    if (pimpl_)
+    {
+        pimpl_->close();
+    }
+}
+
+bool MappedFile::isOpen() const noexcept { return pimpl_ && pimpl_->isOpen(); }
+
+const char *MappedFile::data() const noexcept
+{
+    return pimpl_ ? pimpl_->data() : nullptr;
+}
+
+size_t MappedFile::size() const noexcept { return pimpl_ ? pimpl_->size() : 0; }
+
+MappedFile::Impl::Impl()
+    : data_{nullptr}, size_{0}, mapped_{false}, buffer_{}
+{
+}
+
+MappedFile::Impl::~Impl() { close(); }
+
+bool MappedFile::Impl::open(const char *fileName)
+{
+    close();
+
+    return map(fileName) || read(fileName);
+}
+
+void MappedFile::Impl::close() noexcept
+{
+#if defined(PROGRAM_SYSTEM_UNIX)
+    if (mapped_)
+    {
+        munmap(const_cast<char *>(data_), size_);
+    }
+#endif
+
+    data_ = nullptr;
+    size_ = 0;
+    mapped_ = false;
+    std::vector<char>{}.swap(buffer_);
+}
+
+bool MappedFile::Impl::isOpen() const noexcept { return data_; }
+
+const char *MappedFile::Impl::data() const noexcept { return data_; }
+
+size_t MappedFile::Impl::size() const noexcept { return size_; }
+
+bool MappedFile::Impl::map(const char *fileName)
+{
+#if defined(PROGRAM_SYSTEM_UNIX)
+    const int descriptor{::open(fileName, O_RDONLY | O_CLOEXEC)};
+    if (descriptor < 0)
+    {
+        return false;
+    }
+
+    struct stat status;
+    if (fstat(descriptor, &status) != 0 || !S_ISREG(status.st_mode))
+    {
+        ::close(descriptor);
+        return false;
+    }
+
+    const auto size{static_cast<size_t>(status.st_size)};
+    if (size == 0)
+    {
+        // mmap rejects zero length, an empty file is still a valid view.
+        ::close(descriptor);
+        data_ = Detail::Constant::emptyContent;
+        return true;
+    }
+
+    void *address{
+        mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0)};
+    ::close(descriptor);
+
+    if (address == MAP_FAILED)
+    {
+        return false;
+    }
+
+    madvise(address, size, MADV_SEQUENTIAL);
+    madvise(address, size, MADV_WILLNEED);
+
+    data_ = static_cast<const char *>(address);
+    size_ = size;
+    mapped_ = true;
+
+    return true;
+#else
+    static_cast<void>(fileName);
+
+    return false;
+#endif
+}
+
+bool MappedFile::Impl::read(const char *fileName)
+{
+    std::ifstream in(fileName, std::ios::in | std::ios::binary);
+
+    if (!in.is_open() || !in.good())
+    {
+        return false;
+    }
+
+    buffer_.resize(static_cast<size_t>(Detail::GetTextLength(in)));
+    in.read(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+
+    data_ = buffer_.empty() ? Detail::Constant::emptyContent : buffer_.data();
+    size_ = buffer_.size();
+
+    return true;
+}
+
+} // namespace FileIO
@@ -0,0 +1,79 @@
+#ifndef MODELVIEWER_UTILS_FILEIO_MAPPEDFILE_HPP_
+#define MODELVIEWER_UTILS_FILEIO_MAPPEDFILE_HPP_
+
+#include <cstddef>
+#include <memory>
+
+namespace FileIO
+{
+
+/**
+ * \brief This class represents a read-only view of the whole file content.
+ *
+ * \details The file is mapped into memory when the platform supports it and
+ * hinted for sequential access. Otherwise the content is read into a buffer
+ * owned by the instance. Either way the view stays valid until the instance
+ * is closed or destroyed.
+ *
+ * \par Warning:
+ * The view is not null terminated. Always use it together with size().
+ *
+ * A moved-from instance has no file opened and may be opened again.
+ */
+class MappedFile
+{
+public:
+    /**
+     * \brief Initializes a new instance of the MappedFile class without any
+     * file opened.
+     */
+    MappedFile();
+
+    /**
+     * \brief Initializes a new instance of the MappedFile class and open
+     * \p fileName.
+     *
+     * \param fileName File to open. Use isOpen to check the result.
+     */
+    explicit MappedFile(const char *fileName);
+
+    MappedFile(MappedFile &&other) noexcept;
+    MappedFile &operator=(MappedFile &&other) noexcept;
+    ~MappedFile();
+
+    MappedFile(const MappedFile &other) = delete;
+    MappedFile &operator=(const MappedFile &other) = delete;
+
+    /**
+     * \brief Open \p fileName and replace the current view with its content.
+     *
+     * \param fileName File to open.
+     * \return Return \c true if the file is opened successfully. Otherwise
+     * return \c false.
+     */
+    bool open(const char *fileName);
+
+    /**
+     * \brief Release the current view.
+     */
+    void close() noexcept;
+
+    bool isOpen() const noexcept;
+
+    /**
+     * \brief Gets the beginning of the file content.
+     *
+     * \return Pointer to the content, or \c nullptr if no file is opened.
+     */
+    const char *data() const noexcept;
+
+    size_t size() const noexcept;
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> pimpl_;
+};
+
+} // namespace FileIO
+
+#endif // MODELVIEWER_UTILS_FILEIO_MAPPEDFILE_HPP_
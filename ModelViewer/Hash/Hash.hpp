@@ -4,6 +4,7 @@
 #include "Utils/PreDefine.hpp"
 
 #include <cstdint>
+#include <cstring>
 
 /**
  * \brief The namespace represent the hash functions.
@@ -53,6 +54,10 @@ public:
         auto pointer{reinterpret_cast<std::uintptr_t>(x)};
         return hashImpl(&pointer, sizeof(pointer));
     }
+    size_t operator()(const void *data, size_t bytes) const
+    {
+        return hashImpl(data, bytes);
+    }
 
 private:
     inline size_t hashImpl(unsigned char x, size_t hash) const
@@ -150,6 +155,10 @@ public:
         auto pointer{reinterpret_cast<std::uintptr_t>(x)};
         return hashImpl(&pointer, sizeof(pointer));
     }
+    uint64_t operator()(const void *data, size_t bytes) const
+    {
+        return hashImpl(data, bytes);
+    }
 
 private:
     const uint64_t multiply = 0xc6a4a7935bd1e995LLU;
@@ -159,13 +168,13 @@ private:
     {
         uint64_t hash{seed ^ (bytes * multiply)};
 
-        const uint64_t *buffer{static_cast<const uint64_t *>(value)};
-        const uint64_t *end{buffer + (bytes / 8)};
+        const unsigned char *buffer{static_cast<const unsigned char *>(value)};
+        const unsigned char *end{buffer + (bytes & ~size_t{7})};
 
-        while (buffer != end)
+        for (; buffer != end; buffer += 8)
         {
-            const uint64_t *pointTo{++buffer};
-            uint64_t key{*pointTo};
+            uint64_t key;
+            std::memcpy(&key, buffer, sizeof(key));
 
             key *= multiply;
             key ^= key >> rotate;
@@ -175,8 +184,7 @@ private:
             hash *= multiply;
         }
 
-        const unsigned char *data{
-            reinterpret_cast<const unsigned char *>(buffer)};
+        const unsigned char *data{buffer};
 
         switch (bytes & 7)
         {
@@ -236,6 +244,10 @@ public:
         auto pointer{reinterpret_cast<std::uintptr_t>(x)};
         return hashImpl(&pointer, sizeof(pointer));
     }
+    uint64_t operator()(const void *data, size_t bytes) const
+    {
+        return hashImpl(data, bytes);
+    }
 
 private:
     const uint32_t multiply = 0x5bd1e995;
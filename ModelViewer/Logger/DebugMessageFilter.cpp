@@ -0,0 +1,254 @@
+#include "DebugMessageFilter.hpp"
+
+#include "Hash/Hash.hpp"
+
+#include <algorithm>
+
+namespace Logger
+{
+
+namespace Detail
+{
+
+uint64_t packKey(GLenum source, GLenum type, GLuint id) noexcept;
+int severityRank(GLenum severity) noexcept;
+
+// The debug enums fit in 16 bits and no source is 0, so no key is 0.
+uint64_t packKey(GLenum source, GLenum type, GLuint id) noexcept
+{
+    return (static_cast<uint64_t>(source & 0xFFFF) << 48) |
+           (static_cast<uint64_t>(type & 0xFFFF) << 32) |
+           static_cast<uint64_t>(id);
+}
+
+int severityRank(GLenum severity) noexcept
+{
+    switch (severity)
+    {
+    case GL_DEBUG_SEVERITY_HIGH:
+        return 3;
+    case GL_DEBUG_SEVERITY_MEDIUM:
+        return 2;
+    case GL_DEBUG_SEVERITY_LOW:
+        return 1;
+    case GL_DEBUG_SEVERITY_NOTIFICATION:
+    default:
+        return 0;
+    }
+}
+
+} // namespace Detail
+
+constexpr size_t DebugMessageFilter::entryCapacity;
+constexpr size_t DebugMessageFilter::thresholdCapacity;
+
+DebugMessageFilter::DebugMessageFilter()
+    : entries_{}, thresholds_{},
+      defaultThreshold_{Detail::severityRank(GL_DEBUG_SEVERITY_NOTIFICATION)},
+      untracked_{0}
+{
+    for (auto &entry : entries_)
+    {
+        entry.key.store(0, std::memory_order_relaxed);
+        entry.severity.store(0, std::memory_order_relaxed);
+        entry.count.store(0, std::memory_order_relaxed);
+        entry.suppressed.store(0, std::memory_order_relaxed);
+        entry.logged.store(false, std::memory_order_relaxed);
+    }
+
+    for (auto &threshold : thresholds_)
+    {
+        threshold.store(0, std::memory_order_relaxed);
+    }
+}
+
+bool DebugMessageFilter::accept(GLenum source, GLenum type, GLuint id,
+                                GLenum severity) noexcept
+{
+    auto entry{find(Detail::packKey(source, type, id), true)};
+    if (!entry)
+    {
+        untracked_.fetch_add(1, std::memory_order_relaxed);
+        return Detail::severityRank(severity) >= threshold(id);
+    }
+
+    entry->severity.store(severity, std::memory_order_relaxed);
+    entry->count.fetch_add(1, std::memory_order_relaxed);
+
+    if (Detail::severityRank(severity) < threshold(id))
+    {
+        return false;
+    }
+
+    // Only one of the threads racing on the first occurrence logs it.
+    if (!entry->logged.exchange(true, std::memory_order_relaxed))
+    {
+        return true;
+    }
+
+    entry->suppressed.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+void DebugMessageFilter::rejected(GLenum source, GLenum type,
+                                  GLuint id) noexcept
+{
+    if (auto entry{find(Detail::packKey(source, type, id), false)})
+    {
+        entry->logged.store(false, std::memory_order_relaxed);
+    }
+}
+
+std::vector<DebugMessageCounter> DebugMessageFilter::counters() const
+{
+    std::vector<DebugMessageCounter> counters;
+    for (const auto &entry : entries_)
+    {
+        const auto key{entry.key.load(std::memory_order_acquire)};
+        if (!key)
+        {
+            continue;
+        }
+
+        counters.push_back(DebugMessageCounter{
+            static_cast<GLenum>(key >> 48),
+            static_cast<GLenum>((key >> 32) & 0xFFFF),
+            static_cast<GLuint>(key & 0xFFFFFFFF),
+            entry.severity.load(std::memory_order_relaxed),
+            entry.count.load(std::memory_order_relaxed),
+            entry.suppressed.load(std::memory_order_relaxed)});
+    }
+
+    std::sort(counters.begin(), counters.end(),
+              [](const DebugMessageCounter &a, const DebugMessageCounter &b) {
+                  return a.count > b.count;
+              });
+
+    return counters;
+}
+
+void DebugMessageFilter::setSeverityThreshold(GLenum severity) noexcept
+{
+    defaultThreshold_.store(Detail::severityRank(severity),
+                            std::memory_order_relaxed);
+}
+
+bool DebugMessageFilter::setSeverityThreshold(GLuint id,
+                                              GLenum severity) noexcept
+{
+    // The id is offset by 1, so no packed threshold is 0.
+    const auto tag{static_cast<uint64_t>(id) + 1};
+    const auto packed{(tag << 8) |
+                      static_cast<uint64_t>(Detail::severityRank(severity))};
+
+    auto index{Hash::FastHash<GLuint>{}(id)};
+    for (size_t probe{0}; probe < thresholdCapacity; ++probe, ++index)
+    {
+        auto &threshold{thresholds_[index % thresholdCapacity]};
+        auto current{threshold.load(std::memory_order_relaxed)};
+        while (!current || (current >> 8) == tag)
+        {
+            if (threshold.compare_exchange_weak(current, packed,
+                                                std::memory_order_relaxed))
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+void DebugMessageFilter::takeSummaries(
+    std::vector<DebugMessageCounter> &summaries)
+{
+    summaries.clear();
+    for (auto &entry : entries_)
+    {
+        const auto key{entry.key.load(std::memory_order_acquire)};
+        if (!key)
+        {
+            continue;
+        }
+
+        const auto suppressed{
+            entry.suppressed.exchange(0, std::memory_order_relaxed)};
+        if (!suppressed)
+        {
+            continue;
+        }
+
+        summaries.push_back(DebugMessageCounter{
+            static_cast<GLenum>(key >> 48),
+            static_cast<GLenum>((key >> 32) & 0xFFFF),
+            static_cast<GLuint>(key & 0xFFFFFFFF),
+            entry.severity.load(std::memory_order_relaxed),
+            entry.count.load(std::memory_order_relaxed), suppressed});
+    }
+}
+
+size_t DebugMessageFilter::untrackedCount() const noexcept
+{
+    return untracked_.load(std::memory_order_relaxed);
+}
+
+DebugMessageFilter::Entry *DebugMessageFilter::find(uint64_t key,
+                                                    bool insert) noexcept
+{
+    auto index{Hash::FastHash<uint64_t>{}(key)};
+    for (size_t probe{0}; probe < entryCapacity; ++probe, ++index)
+    {
+        auto &entry{entries_[index % entryCapacity]};
+        auto current{entry.key.load(std::memory_order_acquire)};
+
+        if (current == key)
+        {
+            return &entry;
+        }
+
+        if (!current && insert)
+        {
+            // Another thread may take the entry first, for the same key or
+            // another one.
+            if (entry.key.compare_exchange_strong(current, key,
+                                                  std::memory_order_acq_rel) ||
+                current == key)
+            {
+                return &entry;
+            }
+        }
+
+        if (!current && !insert)
+        {
+            return nullptr;
+        }
+    }
+
+    return nullptr;
+}
+
+int DebugMessageFilter::threshold(GLuint id) const noexcept
+{
+    const auto tag{static_cast<uint64_t>(id) + 1};
+
+    auto index{Hash::FastHash<GLuint>{}(id)};
+    for (size_t probe{0}; probe < thresholdCapacity; ++probe, ++index)
+    {
+        const auto packed{
+            thresholds_[index % thresholdCapacity].load(
+                std::memory_order_relaxed)};
+        if (!packed)
+        {
+            break;
+        }
+
+        if ((packed >> 8) == tag)
+        {
+            return static_cast<int>(packed & 0xFF);
+        }
+    }
+
+    return defaultThreshold_.load(std::memory_order_relaxed);
+}
+
+} // namespace Logger
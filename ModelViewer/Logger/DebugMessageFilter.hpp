@@ -0,0 +1,130 @@
+#ifndef MODELVIEWER_LOGGER_DEBUGMESSAGEFILTER_HPP_
+#define MODELVIEWER_LOGGER_DEBUGMESSAGEFILTER_HPP_
+
+#include "OpenGL/OpenGLLib.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Logger
+{
+
+/**
+ * \brief This struct represents how often a debug message was seen.
+ */
+struct DebugMessageCounter
+{
+    GLenum source;
+    GLenum type;
+    GLuint id;
+    GLenum severity;
+    size_t count;
+    // Repeats not logged since the last summary.
+    size_t suppressed;
+};
+
+/**
+ * \brief This class decides which OpenGL debug messages are logged.
+ *
+ * \details Messages are counted per (source, type, id) in a fixed hash table
+ * with open addressing. A message is logged once, the first time it passes
+ * the severity threshold of its id, or the default one. The repeats are
+ * counted until takeSummaries collects them. A message that could not be
+ * logged is given back with rejected, so its next occurrence is logged.
+ *
+ * accept may be called from any thread. It is lock-free: the keys are
+ * inserted with a CAS and the counters are atomics. When the table is full,
+ * the new messages are logged every time and counted as untracked.
+ */
+class DebugMessageFilter
+{
+public:
+    explicit DebugMessageFilter();
+
+    DebugMessageFilter(const DebugMessageFilter &other) = delete;
+    DebugMessageFilter(DebugMessageFilter &&other) = delete;
+    DebugMessageFilter &operator=(const DebugMessageFilter &other) = delete;
+    DebugMessageFilter &operator=(DebugMessageFilter &&other) = delete;
+
+    /**
+     * \brief Count the message.
+     *
+     * \return Return \c true if the message should be logged now.
+     * Otherwise, return \c false.
+     */
+    bool accept(GLenum source, GLenum type, GLuint id,
+                GLenum severity) noexcept;
+
+    /**
+     * \brief Marks an accepted message as not logged, the next occurrence is
+     * accepted again.
+     */
+    void rejected(GLenum source, GLenum type, GLuint id) noexcept;
+
+    /**
+     * \brief Sets the lowest severity logged for the ids without their own
+     * threshold. Default is \c GL_DEBUG_SEVERITY_NOTIFICATION, everything is
+     * logged.
+     */
+    void setSeverityThreshold(GLenum severity) noexcept;
+
+    /**
+     * \brief Sets the lowest severity logged for \p id.
+     *
+     * \return Return \c false if the table of thresholds is full. Otherwise,
+     * return \c true.
+     */
+    bool setSeverityThreshold(GLuint id, GLenum severity) noexcept;
+
+    /**
+     * \brief Collect the messages repeated since the last call, and reset
+     * their suppressed count.
+     *
+     * \param summaries Receives the messages with a suppressed count.
+     */
+    void takeSummaries(std::vector<DebugMessageCounter> &summaries);
+
+    /**
+     * \brief Gets the counter of every message seen so far.
+     *
+     * \return Requested value, sorted by count with the most frequent first.
+     */
+    std::vector<DebugMessageCounter> counters() const;
+
+    /**
+     * \brief Gets the number of messages not tracked because the table was
+     * full.
+     */
+    size_t untrackedCount() const noexcept;
+
+private:
+    struct Entry
+    {
+        // Packed source, type and id, 0 for a free entry.
+        std::atomic<uint64_t> key;
+        std::atomic<GLenum> severity;
+        std::atomic<size_t> count;
+        std::atomic<size_t> suppressed;
+        // Set by the accepted occurrence, cleared if it was rejected.
+        std::atomic<bool> logged;
+    };
+
+    static constexpr size_t entryCapacity{256};
+    static constexpr size_t thresholdCapacity{64};
+
+    Entry *find(uint64_t key, bool insert) noexcept;
+    int threshold(GLuint id) const noexcept;
+
+    std::array<Entry, entryCapacity> entries_;
+    // Packed id and severity rank, 0 for a free entry.
+    std::array<std::atomic<uint64_t>, thresholdCapacity> thresholds_;
+    std::atomic<int> defaultThreshold_;
+    std::atomic<size_t> untracked_;
+};
+
+} // namespace Logger
+
+#endif // MODELVIEWER_LOGGER_DEBUGMESSAGEFILTER_HPP_
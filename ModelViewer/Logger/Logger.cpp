@@ -1,5 +1,7 @@
 #include "Logger.hpp"
 
+#include "DebugMessageFilter.hpp"
+
 #include "Utils/PreDefine.hpp"
 #include "Utils/StringFormat/StringFormat.hpp"
 
@@ -7,11 +9,19 @@
 
 #include <ctime>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <mutex>
 #include <sstream>
+#include <thread>
+#include <vector>
 
 namespace Logger
 {
@@ -19,15 +29,227 @@ namespace Logger
 namespace Detail
 {
 
-std::string getCurrentTime();
+namespace Constant
+{
+
+constexpr size_t ringCapacity{256};
+
+constexpr size_t messageCapacity{488};
+
+constexpr std::chrono::milliseconds writeInterval{20};
+
+constexpr std::chrono::seconds summaryInterval{5};
+
+} // namespace Constant
+
+struct Record
+{
+    std::chrono::system_clock::time_point time;
+    GLenum source;
+    GLenum type;
+    GLenum severity;
+    GLuint id;
+    bool truncated;
+    char message[Constant::messageCapacity];
+};
+
+// The sequence tells whether the slot is free for the push of a lap or holds
+// its record, as in Event::ConcurrentEventQueue.
+struct Slot
+{
+    Record record;
+    std::atomic<size_t> sequence;
+};
+
+struct Ring
+{
+    Ring();
+
+    std::array<Slot, Constant::ringCapacity> slots;
+    std::atomic<size_t> tail;
+    // Only the writer thread reads the ring.
+    size_t head;
+    std::atomic<size_t> dropped;
+};
+
+Ring ring;
+
+DebugMessageFilter filter;
+
+// Guards the writer state below.
+std::mutex writerMutex;
+std::condition_variable writerWake;
+std::thread writer;
+std::ofstream file;
+std::ostream *output{nullptr};
+bool stopping{false};
+
+bool push(GLenum source, GLenum type, GLuint id, GLenum severity,
+          GLsizei length, const GLchar *message) noexcept;
+bool pop(Record &record) noexcept;
+void write(std::ostream &stream);
+void writeLoop();
+void writeSummaries(std::ostream &stream,
+                    std::chrono::steady_clock::duration elapsed);
+
+std::string formatTime(std::chrono::system_clock::time_point now);
 std::string getSeverity(GLenum severity);
 std::string getSource(GLenum source);
 std::string getType(GLenum type);
 
-std::string getCurrentTime()
+Ring::Ring() : slots{}, tail{0}, head{0}, dropped{0}
+{
+    for (size_t i{0}; i < slots.size(); ++i)
+    {
+        slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+bool push(GLenum source, GLenum type, GLuint id, GLenum severity,
+          GLsizei length, const GLchar *message) noexcept
+{
+    using Constant::ringCapacity;
+
+    auto position{ring.tail.load(std::memory_order_relaxed)};
+    Slot *slot;
+    for (;;)
+    {
+        slot = &ring.slots[position % ringCapacity];
+        const auto sequence{slot->sequence.load(std::memory_order_acquire)};
+
+        if (sequence == position)
+        {
+            if (ring.tail.compare_exchange_weak(position, position + 1,
+                                                std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (sequence < position)
+        {
+            ring.dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        else
+        {
+            position = ring.tail.load(std::memory_order_relaxed);
+        }
+    }
+
+    auto &record{slot->record};
+    record.time = std::chrono::system_clock::now();
+    record.source = source;
+    record.type = type;
+    record.severity = severity;
+    record.id = id;
+
+    // A negative length means the message is null terminated.
+    const auto size{length < 0 ? std::strlen(message)
+                               : static_cast<size_t>(length)};
+    const auto copied{std::min(size, Constant::messageCapacity - 1)};
+    std::memcpy(record.message, message, copied);
+    record.message[copied] = '\0';
+    record.truncated = copied < size;
+
+    slot->sequence.store(position + 1, std::memory_order_release);
+
+    return true;
+}
+
+bool pop(Record &record) noexcept
+{
+    auto &slot{ring.slots[ring.head % Constant::ringCapacity]};
+    if (slot.sequence.load(std::memory_order_acquire) != ring.head + 1)
+    {
+        return false;
+    }
+
+    record = slot.record;
+
+    // Free the slot for the push of the next lap.
+    slot.sequence.store(ring.head + Constant::ringCapacity,
+                        std::memory_order_release);
+    ++ring.head;
+
+    return true;
+}
+
+void write(std::ostream &stream)
+{
+    Record record;
+    while (pop(record))
+    {
+        stream << StringFormat::StringFormat(
+                      "%u: [%s] [%12s] [%s] [%s]\n%s%s",
+                      record.id, formatTime(record.time).c_str(),
+                      getSeverity(record.severity).c_str(),
+                      getType(record.type).c_str(),
+                      getSource(record.source).c_str(), record.message,
+                      record.truncated ? "..." : "")
+               << "\n";
+    }
+    stream.flush();
+}
+
+void writeLoop()
+{
+    auto lastSummary{std::chrono::steady_clock::now()};
+
+    std::unique_lock<std::mutex> lock{writerMutex};
+    for (;;)
+    {
+        write(*output);
+
+        const auto now{std::chrono::steady_clock::now()};
+        if (stopping || now - lastSummary >= Constant::summaryInterval)
+        {
+            writeSummaries(*output, now - lastSummary);
+            lastSummary = now;
+        }
+
+        if (stopping)
+        {
+            return;
+        }
+
+        // The callback notifies without the lock, so a wake may be missed;
+        // the interval bounds the delay.
+        writerWake.wait_for(lock, Constant::writeInterval);
+    }
+}
+
+void writeSummaries(std::ostream &stream,
+                    std::chrono::steady_clock::duration elapsed)
+{
+    static std::vector<DebugMessageCounter> summaries;
+    filter.takeSummaries(summaries);
+    if (summaries.empty())
+    {
+        return;
+    }
+
+    const auto seconds{
+        std::chrono::duration_cast<std::chrono::duration<double>>(elapsed)
+            .count()};
+    const auto time{formatTime(std::chrono::system_clock::now())};
+    for (const auto &summary : summaries)
+    {
+        stream << StringFormat::StringFormat(
+                      "%u: [%s] [%12s] [%s] [%s]\n"
+                      "%zu more occurrences in the last %.1f s, %zu in total",
+                      summary.id, time.c_str(),
+                      getSeverity(summary.severity).c_str(),
+                      getType(summary.type).c_str(),
+                      getSource(summary.source).c_str(), summary.suppressed,
+                      seconds, summary.count)
+               << "\n";
+    }
+    stream.flush();
+}
+
+std::string formatTime(std::chrono::system_clock::time_point now)
 {
     using namespace std::chrono;
-    auto now{system_clock::now()};
     auto us{duration_cast<microseconds>(now.time_since_epoch()) % 1000000};
 
     auto nowRaw{system_clock::to_time_t(now)};
@@ -119,15 +341,92 @@ void APIENTRY openGLDebugOutput(GLenum source, GLenum type, GLuint id,
                                 GLenum severity, GLsizei length,
                                 const GLchar *message, const void *userParam)
 {
-    PROGRAM_MAYBE_UNUSED(length);
     PROGRAM_MAYBE_UNUSED(userParam);
 
-    auto fullMessage{StringFormat::StringFormat(
-        "%u: [%s] [%12s] [%s] [%s]\n%s", id, Detail::getCurrentTime().c_str(),
-        Detail::getSeverity(severity).c_str(), Detail::getType(type).c_str(),
-        Detail::getSource(source).c_str(), message)};
+    if (!Detail::filter.accept(source, type, id, severity))
+    {
+        return;
+    }
+
+    // The ring is full, the next occurrence gets another chance.
+    if (!Detail::push(source, type, id, severity, length, message))
+    {
+        Detail::filter.rejected(source, type, id);
+        return;
+    }
+
+    Detail::writerWake.notify_one();
+}
+
+bool start(const char *fileName)
+{
+    std::lock_guard<std::mutex> lock{Detail::writerMutex};
+    if (Detail::writer.joinable())
+    {
+        return false;
+    }
+
+    if (fileName)
+    {
+        Detail::file.open(fileName, std::ios::out | std::ios::app);
+        if (!Detail::file)
+        {
+            return false;
+        }
+        Detail::output = &Detail::file;
+    }
+    else
+    {
+        Detail::output = &std::cerr;
+    }
+
+    Detail::stopping = false;
+    Detail::writer = std::thread{Detail::writeLoop};
+
+    return true;
+}
+
+void stop()
+{
+    {
+        std::lock_guard<std::mutex> lock{Detail::writerMutex};
+        if (!Detail::writer.joinable())
+        {
+            return;
+        }
+        Detail::stopping = true;
+    }
+
+    Detail::writerWake.notify_one();
+    Detail::writer.join();
+
+    if (Detail::file.is_open())
+    {
+        Detail::file.close();
+    }
+    Detail::output = nullptr;
+}
+
+size_t droppedCount() noexcept
+{
+    return Detail::ring.dropped.load(std::memory_order_relaxed);
+}
 
-    std::cerr << fullMessage << "\n";
+void setSeverityThreshold(GLenum severity) noexcept
+{
+    Detail::filter.setSeverityThreshold(severity);
 }
 
+bool setSeverityThreshold(GLuint id, GLenum severity) noexcept
+{
+    return Detail::filter.setSeverityThreshold(id, severity);
+}
+
+std::vector<DebugMessageCounter> messageCounters()
+{
+    return Detail::filter.counters();
+}
+
+size_t untrackedCount() noexcept { return Detail::filter.untrackedCount(); }
+
 } // namespace Logger
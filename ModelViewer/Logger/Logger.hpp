@@ -1,19 +1,89 @@
 #ifndef GLFWTUTORIAL_LOGGER_LOGGER_HPP_
 #define GLFWTUTORIAL_LOGGER_LOGGER_HPP_
 
+#include "DebugMessageFilter.hpp"
+
 #include "OpenGL/OpenGLLib.hpp"
 
+#include <cstddef>
 #include <iostream>
 #include <ostream>
 #include <string>
+#include <vector>
 
+/**
+ * \brief This namespace represents the logger of the OpenGL debug messages.
+ *
+ * \details openGLDebugOutput only copies the message into a record of a
+ * lock-free ring and returns. A writer thread formats the records and writes
+ * them to \c stderr or a file. When the ring is full, the message is dropped
+ * and counted, the callback never waits for the writer.
+ *
+ * Before a message reaches the ring, a DebugMessageFilter keyed on its
+ * source, type and id decides whether it is logged. A message is logged the
+ * first time only; its repeats are counted and the writer logs one summary
+ * line per repeated message every few seconds, and when it stops.
+ */
 namespace Logger
 {
 
+/**
+ * \brief The callback for \c glDebugMessageCallback.
+ *
+ * It may be called from any thread. Messages longer than a record are
+ * truncated.
+ */
 void APIENTRY openGLDebugOutput(GLenum source, GLenum type, GLuint id,
                                 GLenum severity, GLsizei length,
                                 const GLchar *message, const void *userParam);
 
+/**
+ * \brief Start the writer thread.
+ *
+ * Messages logged before are kept in the ring until it starts.
+ *
+ * \param fileName File to append the messages to, or \c nullptr for
+ * \c stderr.
+ * \return Return \c false if the writer is running or the file cannot be
+ * opened. Otherwise, return \c true.
+ */
+bool start(const char *fileName = nullptr);
+
+/**
+ * \brief Write the messages left in the ring and stop the writer thread.
+ */
+void stop();
+
+/**
+ * \brief Gets the number of messages dropped because the ring was full.
+ */
+size_t droppedCount() noexcept;
+
+/**
+ * \brief Sets the lowest severity logged for the ids without their own
+ * threshold. Messages below it are still counted.
+ */
+void setSeverityThreshold(GLenum severity) noexcept;
+
+/**
+ * \brief Sets the lowest severity logged for \p id.
+ *
+ * \return Return \c false if no more threshold can be set. Otherwise,
+ * return \c true.
+ */
+bool setSeverityThreshold(GLuint id, GLenum severity) noexcept;
+
+/**
+ * \brief Gets how often each message was seen, the most frequent first.
+ */
+std::vector<DebugMessageCounter> messageCounters();
+
+/**
+ * \brief Gets the number of messages not counted per id because the table of
+ * counters was full. They are logged every time.
+ */
+size_t untrackedCount() noexcept;
+
 } // namespace Logger
 
 #endif // GLFW-TUTORIAL_LOGGER_LOGGER_HPP_
@@ -1,8 +1,13 @@
+#include "Benchmark/BenchmarkReport.hpp"
+#include "Benchmark/CameraPath.hpp"
 #include "OpenGLWindow.hpp"
 #include "OpenGLWindowBuilder.hpp"
+#include "Profiler/Profiler.hpp"
 
 #include "glm/vec2.hpp"
 
+#include <chrono>
+#include <future>
 #include <iostream>
 #include <memory>
 #include <stdexcept>
@@ -15,7 +20,10 @@ int main(int argc, char *argv[])
         std::cerr << "Not enough parameter\n";
         std::cerr << "Expect: " << argv[0]
                   << "[model name] [texture name] [vertex shader file name] "
-                     "[fragment shader file name]"
+                     "[fragment shader file name] [--headless] [--on-demand] "
+                     "[--benchmark camera path file name] "
+                     "[--report report file name] "
+                     "[--trace trace file name]"
                   << std::endl;
         exit(EXIT_FAILURE);
     }
@@ -25,6 +33,62 @@ int main(int argc, char *argv[])
     std::string vertexShader{argv[3]};
     std::string fragmentShader{argv[4]};
 
+    bool headless{false};
+    bool onDemand{false};
+    std::string benchmark;
+    std::string report{"benchmark.json"};
+    std::string trace;
+    for (int i{5}; i < argc; ++i)
+    {
+        std::string option{argv[i]};
+        if (option == "--headless")
+        {
+            headless = true;
+        }
+        else if (option == "--on-demand")
+        {
+            onDemand = true;
+        }
+        else if (option == "--benchmark" && i + 1 < argc)
+        {
+            benchmark = argv[++i];
+        }
+        else if (option == "--report" && i + 1 < argc)
+        {
+            report = argv[++i];
+        }
+        else if (option == "--trace" && i + 1 < argc)
+        {
+            trace = argv[++i];
+        }
+        else
+        {
+            std::cerr << "Unknown option: " << option << std::endl;
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    Benchmark::CameraPath path;
+    if (!benchmark.empty())
+    {
+        std::string error;
+        if (!Benchmark::CameraPath::loadFromFile(benchmark.c_str(), path,
+                                                 error))
+        {
+            std::cerr << error << std::endl;
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    // Trace from the start, so the loading is in it.
+    Profiler::setEnabled(!trace.empty());
+    auto exportTrace{[&trace]() {
+        if (!trace.empty() && !Profiler::exportChromeTrace(trace.c_str()))
+        {
+            std::cerr << "Failed to write " << trace << std::endl;
+        }
+    }};
+
     std::cout << "Vertex Shader: " << vertexShader << "\n"
               << "Fragment Shader: " << fragmentShader << "\n"
               << "Model: " << model << "\n"
@@ -36,6 +100,7 @@ int main(int argc, char *argv[])
                     .setTitle("LearnOpenGL")
                     .setPosition(100, 100)
                     .setSize(800, 600)
+                    .setHeadless(headless)
                     .build()};
 
     if (!window)
@@ -52,13 +117,60 @@ int main(int argc, char *argv[])
         exit(EXIT_FAILURE);
     }
 
-    if (!window->addModel(model.c_str(), texture.c_str(), *shaderProgram))
+    if (!benchmark.empty())
     {
-        std::cerr << "Failed to add model" << std::endl;
-        exit(EXIT_FAILURE);
+        // Load before the first frame, so every run measures the same scene.
+        Benchmark::BenchmarkReport benchmarkReport{benchmark, model};
+
+        auto loadStart{std::chrono::steady_clock::now()};
+        if (!window->addModel(model.c_str(), texture.c_str(), *shaderProgram))
+        {
+            std::cerr << "Failed to add model" << std::endl;
+            exit(EXIT_FAILURE);
+        }
+        benchmarkReport.setLoadTime(
+            std::chrono::duration<double>{std::chrono::steady_clock::now() -
+                                          loadStart}
+                .count());
+
+        window->startBenchmark(path, benchmarkReport);
+        exportTrace();
+
+        if (!benchmarkReport.writeToFile(report.c_str()))
+        {
+            std::cerr << "Failed to write " << report << std::endl;
+            exit(EXIT_FAILURE);
+        }
+        std::cout << "Benchmark report: " << report << std::endl;
+
+        return 0;
     }
 
+    window->setRenderOnDemand(onDemand);
+
+    auto modelAdded{window->addModelAsync(model.c_str(), texture.c_str(),
+                                          *shaderProgram)};
+
     window->startRender();
+    exportTrace();
+
+    // The window reported a failed load when it completed, only the exit
+    // status is left.
+    if (modelAdded.wait_for(std::chrono::seconds{0}) ==
+        std::future_status::ready)
+    {
+        try
+        {
+            if (!modelAdded.get())
+            {
+                exit(EXIT_FAILURE);
+            }
+        }
+        catch (const std::exception &)
+        {
+            exit(EXIT_FAILURE);
+        }
+    }
 
     return 0;
 }
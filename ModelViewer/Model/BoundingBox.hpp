@@ -0,0 +1,17 @@
+#ifndef MODELVIEWER_MODEL_BOUNDINGBOX_HPP_
+#define MODELVIEWER_MODEL_BOUNDINGBOX_HPP_
+
+#include "glm/vec3.hpp"
+
+namespace Model
+{
+
+struct BoundingBox
+{
+    glm::vec3 minimum;
+    glm::vec3 maximum;
+};
+
+} // namespace Model
+
+#endif // MODELVIEWER_MODEL_BOUNDINGBOX_HPP_
@@ -0,0 +1,17 @@
+#ifndef MODELVIEWER_MODEL_BOUNDINGSPHERE_HPP_
+#define MODELVIEWER_MODEL_BOUNDINGSPHERE_HPP_
+
+#include "glm/vec3.hpp"
+
+namespace Model
+{
+
+struct BoundingSphere
+{
+    glm::vec3 center;
+    float radius;
+};
+
+} // namespace Model
+
+#endif // MODELVIEWER_MODEL_BOUNDINGSPHERE_HPP_
@@ -0,0 +1,21 @@
+#ifndef MODELVIEWER_MODEL_IMAGEDATA_HPP_
+#define MODELVIEWER_MODEL_IMAGEDATA_HPP_
+
+#include "OpenGL/OpenGLLib.hpp"
+
+#include <vector>
+
+namespace Model
+{
+
+struct ImageData
+{
+    GLsizei width;
+    GLsizei height;
+    GLenum format;
+    std::vector<unsigned char> pixels;
+};
+
+} // namespace Model
+
+#endif // MODELVIEWER_MODEL_IMAGEDATA_HPP_
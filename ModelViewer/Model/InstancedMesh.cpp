@@ -0,0 +1,171 @@
+#include "InstancedMesh.hpp"
+
+#include "OpenGL/OpenGLStateCache.hpp"
+#include "Utils/PreDefine.hpp"
+
+#include "glm/vec4.hpp"
+
+#include <algorithm>
+
+namespace Model
+{
+
+namespace Detail
+{
+
+namespace Constant
+{
+
+constexpr GLuint instanceAttribute{3};
+constexpr GLuint instanceAttributeCount{4};
+
+constexpr size_t minimumCapacity{16};
+
+} // namespace Constant
+
+} // namespace Detail
+
+InstancedMesh::InstancedMesh(const MeshData &data,
+                             ShaderProgramType &shaderProgram,
+                             TextureType *texture)
+    : mesh_{data, shaderProgram, texture},
+      viewProjectionLocation_{
+          shaderProgram.uniformLocation("viewProjection")},
+      instanceBufferObject_{std::make_unique<BufferObjectType>(
+          OpenGL::OpenGLBufferObject::Type::ArrayBuffer,
+          OpenGL::OpenGLBufferObject::UsagePattern::DynamicDraw)},
+      instances_{}, capacity_{0}
+{
+    mapInstanceAttributes();
+}
+
+InstancedMesh::InstancedMesh(InstancedMesh &&other) noexcept = default;
+
+InstancedMesh &InstancedMesh::operator=(InstancedMesh &&other) noexcept =
+    default;
+
+InstancedMesh::~InstancedMesh() = default;
+
+void InstancedMesh::draw(const glm::mat4 &view, const glm::mat4 &projection)
+{
+    if (instances_.empty())
+    {
+        return;
+    }
+
+    if (auto texture{mesh_.texture()})
+    {
+        OpenGL::OpenGLStateCache::current().activeTexture(GL_TEXTURE0);
+        texture->bind();
+    }
+
+    auto &program{mesh_.shaderProgram()};
+    program.use();
+    program.setValue<4, 4>(viewProjectionLocation_, projection * view, false);
+
+    mesh_.vertexArrayObject().bind();
+    glDrawElementsInstanced(GL_TRIANGLES, mesh_.indexCount(), GL_UNSIGNED_INT,
+                            0, static_cast<GLsizei>(instances_.size()));
+}
+
+size_t InstancedMesh::addInstance(const glm::mat4 &model)
+{
+    instances_.push_back(model);
+
+    if (instances_.size() > capacity_)
+    {
+        reserve(std::max(capacity_ * 2, Detail::Constant::minimumCapacity));
+    }
+    else
+    {
+        writeInstance(instances_.size() - 1);
+    }
+
+    return instances_.size() - 1;
+}
+
+void InstancedMesh::setInstance(size_t index, const glm::mat4 &model)
+{
+    PROGRAM_ASSERT(index < instances_.size());
+
+    instances_[index] = model;
+    writeInstance(index);
+}
+
+void InstancedMesh::removeInstance(size_t index)
+{
+    PROGRAM_ASSERT(index < instances_.size());
+
+    const auto last{instances_.size() - 1};
+    if (index != last)
+    {
+        instances_[index] = instances_[last];
+        writeInstance(index);
+    }
+
+    instances_.pop_back();
+}
+
+void InstancedMesh::reserve(size_t instanceCount)
+{
+    if (instanceCount <= capacity_ && instances_.size() <= capacity_)
+    {
+        return;
+    }
+
+    // Reallocating keeps the buffer id, the attribute mapping stays valid.
+    capacity_ = std::max(instanceCount, instances_.size());
+    instanceBufferObject_->bind();
+    instanceBufferObject_->allocateBufferData(
+        nullptr, static_cast<GLsizeiptr>(sizeof(glm::mat4) * capacity_));
+    if (!instances_.empty())
+    {
+        instanceBufferObject_->writeBufferData(
+            0, instances_.data(),
+            static_cast<GLsizeiptr>(sizeof(glm::mat4) * instances_.size()));
+    }
+}
+
+const glm::mat4 &InstancedMesh::instance(size_t index) const noexcept
+{
+    return instances_[index];
+}
+
+size_t InstancedMesh::instanceCount() const noexcept
+{
+    return instances_.size();
+}
+
+const Mesh &InstancedMesh::mesh() const noexcept { return mesh_; }
+
+void InstancedMesh::mapInstanceAttributes()
+{
+    auto &program{mesh_.shaderProgram()};
+
+    mesh_.vertexArrayObject().bind();
+    instanceBufferObject_->bind();
+
+    // A mat4 attribute takes four consecutive locations, one per column.
+    for (GLuint column{0}; column < Detail::Constant::instanceAttributeCount;
+         ++column)
+    {
+        const auto index{Detail::Constant::instanceAttribute + column};
+        program.enableAttributeArray(index);
+        program.mapAttributePointer(
+            index, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4),
+            static_cast<int>(sizeof(glm::vec4) * column));
+        program.setAttributeDivisor(index, 1);
+    }
+
+    mesh_.vertexArrayObject().release();
+}
+
+void InstancedMesh::writeInstance(size_t index)
+{
+    instanceBufferObject_->bind();
+    instanceBufferObject_->writeBufferData(
+        static_cast<GLintptr>(sizeof(glm::mat4) * index), &instances_[index],
+        sizeof(glm::mat4));
+}
+
+} // namespace Model
@@ -0,0 +1,83 @@
+#ifndef MODELVIEWER_MODEL_INSTANCEDMESH_HPP_
+#define MODELVIEWER_MODEL_INSTANCEDMESH_HPP_
+
+#include "OpenGL/OpenGLBufferObject.hpp"
+#include "OpenGL/OpenGLShaderProgram.hpp"
+#include "Mesh.hpp"
+#include "MeshData.hpp"
+
+#include "glm/mat4x4.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace Model
+{
+
+/*
+ * Many copies of one mesh, drawn with a single glDrawElementsInstanced. All
+ * the copies share the vertex and element buffers of the mesh. The model
+ * matrix of each copy lives in an instance buffer which feeds the attributes
+ * 3 to 6 with a divisor of 1, see Shader/InstancedVertexShader.vs.glsl.
+ */
+class InstancedMesh
+{
+public:
+    using ShaderProgramType = Mesh::ShaderProgramType;
+    using TextureType = Mesh::TextureType;
+
+    explicit InstancedMesh(const MeshData &data,
+                           ShaderProgramType &shaderProgram,
+                           TextureType *texture = nullptr);
+
+    InstancedMesh(InstancedMesh &&other) noexcept;
+    InstancedMesh &operator=(InstancedMesh &&other) noexcept;
+    ~InstancedMesh();
+
+    InstancedMesh(const InstancedMesh &other) = delete;
+    InstancedMesh &operator=(const InstancedMesh &other) = delete;
+
+    void draw(const glm::mat4 &view, const glm::mat4 &projection);
+
+    /*
+     * Return the index of the new instance. Only the new slot is uploaded
+     * unless the instance buffer has to grow.
+     */
+    size_t addInstance(const glm::mat4 &model);
+
+    /*
+     * Upload only the slot of index.
+     */
+    void setInstance(size_t index, const glm::mat4 &model);
+
+    /*
+     * Move the last instance into index, so the index of the last instance
+     * changes to index.
+     */
+    void removeInstance(size_t index);
+
+    void reserve(size_t instanceCount);
+
+    const glm::mat4 &instance(size_t index) const noexcept;
+    size_t instanceCount() const noexcept;
+
+    const Mesh &mesh() const noexcept;
+
+private:
+    using BufferObjectType = OpenGL::OpenGLBufferObject;
+
+    void mapInstanceAttributes();
+    void writeInstance(size_t index);
+
+    Mesh mesh_;
+    OpenGL::UniformLocation viewProjectionLocation_;
+
+    std::unique_ptr<BufferObjectType> instanceBufferObject_;
+    std::vector<glm::mat4> instances_;
+    size_t capacity_;
+};
+
+} // namespace Model
+
+#endif // MODELVIEWER_MODEL_INSTANCEDMESH_HPP_
@@ -1,24 +1,49 @@
 #include "Mesh.hpp"
 
+#include "OpenGL/OpenGLStateCache.hpp"
+
+#include "glm/vec4.hpp"
+
 namespace Model
 {
 
 Mesh::Mesh() noexcept
-    : shaderProgram_{nullptr}, texture_{nullptr}, vertexArrayObject_{nullptr},
-      vertexBufferObject_{nullptr}, elementBufferObject_{nullptr},
-      indicesCount_{0}, model_{1}
+    : shaderProgram_{nullptr}, mvpLocation_{-1}, texture_{nullptr},
+      vertexArrayObject_{nullptr}, vertexBufferObject_{nullptr},
+      elementBufferObject_{nullptr},
+      indicesCount_{0}, boundingBox_{glm::vec3{0.0f}, glm::vec3{0.0f}},
+      boundingSphere_{glm::vec3{0.0f}, 0.0f}, model_{1}
 {
 }
 
 Mesh::Mesh(const std::vector<Vertex> &vertices,
            const std::vector<IndexType> &indices,
            ShaderProgramType &shaderProgram, TextureType *texture)
-    : shaderProgram_{&shaderProgram}, texture_{texture},
+    : shaderProgram_{&shaderProgram},
+      mvpLocation_{shaderProgram.uniformLocation("mvp")}, texture_{texture},
       vertexArrayObject_{nullptr}, vertexBufferObject_{nullptr},
       elementBufferObject_{nullptr},
-      indicesCount_{static_cast<GLsizei>(indices.size())}, model_{1}
+      indicesCount_{static_cast<GLsizei>(indices.size())},
+      boundingBox_{MeshData::computeBoundingBox(vertices)},
+      boundingSphere_{
+          MeshData::computeBoundingSphere(vertices, boundingBox_)},
+      model_{1}
 {
-    create(vertices, indices);
+    create(vertices.data(), vertices.size(), indices.data(), indices.size());
+}
+
+Mesh::Mesh(const MeshData &data, ShaderProgramType &shaderProgram,
+           TextureType *texture)
+    : shaderProgram_{&shaderProgram},
+      mvpLocation_{shaderProgram.uniformLocation("mvp")}, texture_{texture},
+      vertexArrayObject_{nullptr}, vertexBufferObject_{nullptr},
+      elementBufferObject_{nullptr},
+      indicesCount_{static_cast<GLsizei>(data.indexCount())},
+      boundingBox_{data.boundingBox()},
+      boundingSphere_{data.boundingSphere()}, model_{1}
+{
+    create(data.vertices(), data.vertexCount(), data.indices(),
+           data.indexCount());
 }
 
 Mesh::Mesh(Mesh &&other) noexcept = default;
@@ -27,8 +52,8 @@ Mesh &Mesh::operator=(Mesh &&other) noexcept = default;
 
 Mesh::~Mesh() noexcept = default;
 
-void Mesh::create(const std::vector<Vertex> &vertices,
-                  const std::vector<IndexType> &indices)
+void Mesh::create(const Vertex *vertices, size_t vertexCount,
+                  const IndexType *indices, size_t indexCount)
 {
     vertexArrayObject_.reset(new VertexArrayObjectType{});
     vertexBufferObject_.reset(new BufferObjectType{
@@ -41,8 +66,8 @@ void Mesh::create(const std::vector<Vertex> &vertices,
     vertexArrayObject_->bind();
 
     vertexBufferObject_->bind();
-    vertexBufferObject_->allocateBufferData(vertices.data(),
-                                            sizeof(Vertex) * vertices.size());
+    vertexBufferObject_->allocateBufferData(
+        vertices, static_cast<GLsizeiptr>(sizeof(Vertex) * vertexCount));
 
     programMapAttribute(*shaderProgram_, 0, 3, GL_FLOAT, GL_FALSE,
                         sizeof(Vertex), offsetof(Vertex, position));
@@ -55,16 +80,16 @@ void Mesh::create(const std::vector<Vertex> &vertices,
 
     elementBufferObject_->bind();
     elementBufferObject_->allocateBufferData(
-        indices.data(), sizeof(IndexType) * indices.size());
+        indices, static_cast<GLsizeiptr>(sizeof(IndexType) * indexCount));
 
     vertexArrayObject_->release();
 }
 
 void Mesh::draw(glm::mat4 &view, glm::mat4 &projection)
 {
-    if (!(texture_))
+    if (texture_)
     {
-        glActiveTexture(GL_TEXTURE0);
+        OpenGL::OpenGLStateCache::current().activeTexture(GL_TEXTURE0);
         texture_->bind();
     }
 
@@ -72,18 +97,48 @@ void Mesh::draw(glm::mat4 &view, glm::mat4 &projection)
 
     glm::mat4 mvp{projection * view * model_};
 
-    shaderProgram_->setValue<4, 4>("mvp", mvp, false);
+    shaderProgram_->setValue<4, 4>(mvpLocation_, mvp, false);
 
+    // Left bound, the next mesh skips the bind if it shares the same one.
     vertexArrayObject_->bind();
     glDrawElements(GL_TRIANGLES, indicesCount_, GL_UNSIGNED_INT, 0);
-    vertexArrayObject_->release();
+}
 
-    if (!(texture_))
-    {
-        glActiveTexture(GL_TEXTURE0);
-    }
+void Mesh::submit(Render::RenderQueue &queue, const glm::mat4 &view) const
+{
+    const glm::vec4 center{view * model_ *
+                           glm::vec4{boundingSphere_.center, 1.0f}};
+
+    queue.submit(Render::DrawPacket{shaderProgram_, mvpLocation_, texture_,
+                                    vertexArrayObject_.get(), indicesCount_,
+                                    model_, -center.z, false});
 }
 
+glm::mat4 Mesh::model() { return model_; }
+
+void Mesh::setModel(glm::mat4 &model) { model_ = model; }
+
+const BoundingBox &Mesh::boundingBox() const noexcept { return boundingBox_; }
+
+const BoundingSphere &Mesh::boundingSphere() const noexcept
+{
+    return boundingSphere_;
+}
+
+Mesh::ShaderProgramType &Mesh::shaderProgram() const noexcept
+{
+    return *shaderProgram_;
+}
+
+Mesh::TextureType *Mesh::texture() const noexcept { return texture_; }
+
+OpenGL::OpenGLVertexArrayObject &Mesh::vertexArrayObject() const noexcept
+{
+    return *vertexArrayObject_;
+}
+
+GLsizei Mesh::indexCount() const noexcept { return indicesCount_; }
+
 void Mesh::programMapAttribute(ShaderProgramType &program, GLuint index,
                                GLint size, GLenum type, GLboolean normalized,
                                GLsizei stride, int offset)
@@ -5,6 +5,10 @@
 #include "OpenGL/OpenGLShaderProgram.hpp"
 #include "OpenGL/OpenGLTexture.hpp"
 #include "OpenGL/OpenGLVertexArrayObject.hpp"
+#include "Render/RenderQueue.hpp"
+#include "BoundingBox.hpp"
+#include "BoundingSphere.hpp"
+#include "MeshData.hpp"
 #include "Vertex.hpp"
 
 #include "glm/mat4x4.hpp"
@@ -28,6 +32,8 @@ public:
                   const std::vector<IndexType> &indices,
                   ShaderProgramType &shaderProgram,
                   TextureType *texture = nullptr);
+    explicit Mesh(const MeshData &data, ShaderProgramType &shaderProgram,
+                  TextureType *texture = nullptr);
 
     Mesh(Mesh &&other) noexcept;
     Mesh &operator=(Mesh &&other) noexcept;
@@ -38,15 +44,28 @@ public:
 
     void draw(glm::mat4 &view, glm::mat4 &projection);
 
+    /*
+     * Submit the draw call of the mesh to queue instead of drawing it now.
+     */
+    void submit(Render::RenderQueue &queue, const glm::mat4 &view) const;
+
     glm::mat4 model();
     void setModel(glm::mat4 &model);
 
+    const BoundingBox &boundingBox() const noexcept;
+    const BoundingSphere &boundingSphere() const noexcept;
+
+    ShaderProgramType &shaderProgram() const noexcept;
+    TextureType *texture() const noexcept;
+    OpenGL::OpenGLVertexArrayObject &vertexArrayObject() const noexcept;
+    GLsizei indexCount() const noexcept;
+
 private:
     using VertexArrayObjectType = OpenGL::OpenGLVertexArrayObject;
     using BufferObjectType = OpenGL::OpenGLBufferObject;
 
-    void create(const std::vector<Vertex> &vertices,
-                const std::vector<IndexType> &indices);
+    void create(const Vertex *vertices, size_t vertexCount,
+                const IndexType *indices, size_t indexCount);
 
     static void programMapAttribute(ShaderProgramType &program, GLuint index,
                                     GLint size, GLenum type,
@@ -54,6 +73,7 @@ private:
                                     int offset);
 
     ShaderProgramType *shaderProgram_;
+    OpenGL::UniformLocation mvpLocation_;
     TextureType *texture_;
 
     std::unique_ptr<VertexArrayObjectType> vertexArrayObject_;
@@ -62,6 +82,9 @@ private:
 
     GLsizei indicesCount_;
 
+    BoundingBox boundingBox_;
+    BoundingSphere boundingSphere_;
+
     glm::mat4 model_;
 };
 
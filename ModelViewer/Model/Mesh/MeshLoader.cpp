@@ -2,7 +2,8 @@
 
 #include "FileIO/FileIO.hpp"
 #include "Hash/Hash.hpp"
-#include "Model/VertexMap.hpp"
+#include "Model/ObjParser.hpp"
+#include "Model/VertexDeduplication.hpp"
 #include "Utils/PreDefine.hpp"
 #include "Vertex.hpp"
 
@@ -13,9 +14,8 @@ PRAGMA_WARNING_DISABLE_DOUBLEPROMOTION
 
 PRAGMA_WARNING_POP
 
-#include "tiny_obj_loader.h"
-
 #include <iostream>
+#include <iterator>
 #include <unordered_map>
 
 namespace Model
@@ -30,47 +30,25 @@ namespace Loader
 namespace Detail
 {
 
-void getData(const tinyobj::attrib_t &attribute,
-             const std::vector<tinyobj::shape_t> &shapes,
-             std::vector<Vertex> &vertices, std::vector<unsigned int> &indices);
-std::shared_ptr<Mesh> getMesh(const tinyobj::attrib_t &attribute,
-                              const std::vector<tinyobj::shape_t> &shapes,
+void getData(const Obj::Data &data, std::vector<Vertex> &vertices,
+             std::vector<unsigned int> &indices);
+std::shared_ptr<Mesh> getMesh(const Obj::Data &data,
                               OpenGL::OpenGLFunction &gl,
                               std::shared_ptr<QOpenGLShaderProgram> program,
                               std::shared_ptr<QOpenGLTexture> texture);
-Vertex getVertex(const tinyobj::attrib_t &attribute, tinyobj::index_t &index);
+Vertex getVertex(const Obj::Data &data, const Obj::Index &index);
 GLenum rgbFormat(int channels) noexcept;
 
-void getData(const tinyobj::attrib_t &attribute,
-             const std::vector<tinyobj::shape_t> &shapes,
-             std::vector<Vertex> &vertices, std::vector<unsigned int> &indices)
+void getData(const Obj::Data &data, std::vector<Vertex> &vertices,
+             std::vector<unsigned int> &indices)
 {
-    VertexMap<Vertex, GLuint> map;
-
-    for (const auto &shape : shapes)
-    {
-        size_t indexOffset{0};
-
-        for (const auto &faceVertices : shape.mesh.num_face_vertices)
-        {
-            size_t castedFaceVertices{static_cast<size_t>(faceVertices)};
-            for (size_t v{0}; v < castedFaceVertices; ++v)
-            {
-                auto index{shape.mesh.indices[indexOffset + v]};
-                auto vertex{getVertex(attribute, index)};
-                map.insert(vertex);
-            }
-
-            indexOffset += castedFaceVertices;
-        }
-    }
-
-    map.getVertices(vertices);
-    map.getIndices(indices);
+    deduplicate(
+        data.indices.size(),
+        [&data](size_t i) { return getVertex(data, data.indices[i]); },
+        vertices, indices);
 }
 
-std::shared_ptr<Mesh> getMesh(const tinyobj::attrib_t &attribute,
-                              const std::vector<tinyobj::shape_t> &shapes,
+std::shared_ptr<Mesh> getMesh(const Obj::Data &data,
                               OpenGL::OpenGLFunction &gl,
                               std::shared_ptr<QOpenGLShaderProgram> program,
                               std::shared_ptr<QOpenGLTexture> texture)
@@ -78,28 +56,38 @@ std::shared_ptr<Mesh> getMesh(const tinyobj::attrib_t &attribute,
     std::vector<GLuint> indices;
     std::vector<Vertex> vertices;
 
-    Detail::getData(attribute, shapes, vertices, indices);
+    Detail::getData(data, vertices, indices);
 
     return std::make_shared<Model::Mesh::Mesh>(vertices, indices, gl, program,
                                                texture);
 }
 
-Vertex getVertex(const tinyobj::attrib_t &attribute, tinyobj::index_t &index)
+Vertex getVertex(const Obj::Data &data, const Obj::Index &index)
 {
-    auto position{glm::vec3{
-        attribute.vertices[static_cast<size_t>(3 * index.vertex_index + 0)],
-        attribute.vertices[static_cast<size_t>(3 * index.vertex_index + 1)],
-        attribute.vertices[static_cast<size_t>(3 * index.vertex_index + 2)]}};
-    auto normal{glm::vec3{
-        attribute.normals[static_cast<size_t>(3 * index.normal_index + 0)],
-        attribute.normals[static_cast<size_t>(3 * index.normal_index + 1)],
-        attribute.normals[static_cast<size_t>(3 * index.normal_index + 2)]}};
-    auto texture{glm::vec2{
-        attribute.texcoords[static_cast<size_t>(2 * index.texcoord_index + 0)],
-        attribute
-            .texcoords[static_cast<size_t>(2 * index.texcoord_index + 1)]}};
-
-    return Model::Mesh::Vertex{position, normal, texture};
+    const auto vertex{static_cast<size_t>(index.vertex)};
+    auto position{glm::vec3{data.vertices[3 * vertex + 0],
+                            data.vertices[3 * vertex + 1],
+                            data.vertices[3 * vertex + 2]}};
+
+    auto normal{glm::vec3{0.0f}};
+    if (index.normal >= 0)
+    {
+        const auto n{static_cast<size_t>(index.normal)};
+        normal = glm::vec3{data.normals[3 * n + 0], data.normals[3 * n + 1],
+                           data.normals[3 * n + 2]};
+    }
+
+    auto texture{glm::vec2{0.0f}};
+    if (index.textureCoordinate >= 0)
+    {
+        const auto t{static_cast<size_t>(index.textureCoordinate)};
+        texture = glm::vec2{data.textureCoordinates[2 * t + 0],
+                            data.textureCoordinates[2 * t + 1]};
+    }
+
+    // Fold -0 into +0, equal vertices must hash equally to be deduplicated.
+    return Model::Mesh::Vertex{position + 0.0f, normal + 0.0f,
+                               texture + 0.0f};
 }
 
 GLenum rgbFormat(int channels) noexcept
@@ -125,15 +113,12 @@ loadMeshFromFile(const char *model,
                  std::shared_ptr<QOpenGLShaderProgram> program,
                  std::shared_ptr<QOpenGLTexture> texture)
 {
-    tinyobj::attrib_t attribute;
-    std::vector<tinyobj::shape_t> shapes;
-    std::vector<tinyobj::material_t> materials;
+    Obj::Data data;
 
     std::string warning;
     std::string error;
 
-    auto loadStatus = tinyobj::LoadObj(&attribute, &shapes, &materials,
-                                       &warning, &error, model);
+    auto loadStatus{Obj::parseFile(model, data, warning, error)};
 
     if (!warning.empty())
     {
@@ -150,7 +135,7 @@ loadMeshFromFile(const char *model,
         return nullptr;
     }
 
-    return Detail::getMesh(attribute, shapes, gl, program, texture);
+    return Detail::getMesh(data, gl, program, texture);
 }
 
 std::shared_ptr<Mesh>
@@ -158,15 +143,15 @@ loadModelFromStream(std::istream &stream, OpenGL::OpenGLFunction &gl,
                     std::shared_ptr<QOpenGLShaderProgram> program,
                     std::shared_ptr<QOpenGLTexture> texture)
 {
-    tinyobj::attrib_t attribute;
-    std::vector<tinyobj::shape_t> shapes;
-    std::vector<tinyobj::material_t> materials;
+    std::string text{std::istreambuf_iterator<char>{stream},
+                     std::istreambuf_iterator<char>{}};
+    Obj::Data data;
 
     std::string warning;
     std::string error;
 
-    auto loadStatus = tinyobj::LoadObj(&attribute, &shapes, &materials,
-                                       &warning, &error, &stream);
+    auto loadStatus{
+        Obj::parse(text.data(), text.size(), data, warning, error)};
 
     if (!warning.empty())
     {
@@ -183,7 +168,7 @@ loadModelFromStream(std::istream &stream, OpenGL::OpenGLFunction &gl,
         return nullptr;
     }
 
-    return Detail::getMesh(attribute, shapes, gl, program, texture);
+    return Detail::getMesh(data, gl, program, texture);
 }
 
 std::shared_ptr<OpenGL::OpenGLTexture>
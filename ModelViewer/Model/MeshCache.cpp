@@ -0,0 +1,320 @@
+#include "MeshCache.hpp"
+
+#include "Hash/Hash.hpp"
+#include "Profiler/Profiler.hpp"
+#include "Utils/PreDefine.hpp"
+
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+
+namespace Model
+{
+
+namespace MeshCache
+{
+
+namespace Detail
+{
+
+namespace Constant
+{
+
+constexpr uint64_t magic{0x00004853454D564DLLU}; // "MVMESH"
+// Version 5: the optimizer report is stored in the header.
+constexpr uint32_t version{5};
+
+constexpr uint32_t optimizedFlag{1};
+
+constexpr const char *extension{".meshcache"};
+constexpr const char *temporaryExtension{".tmp"};
+
+} // namespace Constant
+
+struct Header
+{
+    uint64_t magic;
+    uint32_t version;
+    uint32_t vertexSize;
+    uint32_t indexSize;
+    uint32_t flags;
+    uint64_t sourceSize;
+    int64_t sourceModifiedTime;
+    uint64_t contentHash;
+    uint64_t vertexCount;
+    uint64_t indexCount;
+    float minimum[3];
+    float maximum[3];
+    float sphere[4];
+    double missRatioBefore;
+    double missRatioAfter;
+};
+
+static_assert(sizeof(Header) % alignof(Vertex) == 0,
+              "Vertices must stay aligned after the header.");
+static_assert(sizeof(Vertex) % alignof(MeshData::IndexType) == 0,
+              "Indices must stay aligned after the vertices.");
+
+struct SourceStatus
+{
+    uint64_t size;
+    int64_t modifiedTime;
+};
+
+bool sourceStatus(const char *model, SourceStatus &status);
+uint64_t contentHash(const char *source, size_t size);
+bool isCompatible(const Header &header, size_t fileSize);
+bool isInRange(const MeshData::IndexType *indices, size_t indexCount,
+               size_t vertexCount);
+bool updateModifiedTime(const std::string &fileName, int64_t modifiedTime);
+uint32_t flags(bool optimized) noexcept;
+
+bool sourceStatus(const char *model, SourceStatus &status)
+{
+    struct stat result;
+    if (stat(model, &result) != 0)
+    {
+        return false;
+    }
+
+    status.size = static_cast<uint64_t>(result.st_size);
+#if defined(PROGRAM_SYSTEM_LINUX)
+    status.modifiedTime =
+        static_cast<int64_t>(result.st_mtim.tv_sec) * 1000000000 +
+        static_cast<int64_t>(result.st_mtim.tv_nsec);
+#else
+    status.modifiedTime = static_cast<int64_t>(result.st_mtime);
+#endif
+
+    return true;
+}
+
+uint64_t contentHash(const char *source, size_t size)
+{
+    return Hash::FastHash<unsigned char>{}(source, size);
+}
+
+bool isCompatible(const Header &header, size_t fileSize)
+{
+    if (header.magic != Constant::magic ||
+        header.version != Constant::version ||
+        header.vertexSize != sizeof(Vertex) ||
+        header.indexSize != sizeof(MeshData::IndexType))
+    {
+        return false;
+    }
+
+    const size_t payload{fileSize - sizeof(Header)};
+    if (header.vertexCount > payload / sizeof(Vertex) ||
+        header.indexCount > payload / sizeof(MeshData::IndexType))
+    {
+        return false;
+    }
+
+    return header.indexCount % 3 == 0 &&
+           payload == header.vertexCount * sizeof(Vertex) +
+                          header.indexCount * sizeof(MeshData::IndexType);
+}
+
+// The payload is not hashed, a corrupt entry must not send an index past the
+// vertices to the draw call.
+bool isInRange(const MeshData::IndexType *indices, size_t indexCount,
+               size_t vertexCount)
+{
+    PROGRAM_PROFILE_ZONE("MeshCache::isInRange");
+
+    MeshData::IndexType maximum{0};
+    for (size_t i{0}; i < indexCount; ++i)
+    {
+        maximum = std::max(maximum, indices[i]);
+    }
+
+    return indexCount == 0 || maximum < vertexCount;
+}
+
+bool updateModifiedTime(const std::string &fileName, int64_t modifiedTime)
+{
+    std::fstream out(fileName, std::ios::in | std::ios::out | std::ios::binary);
+
+    if (!out.is_open())
+    {
+        return false;
+    }
+
+    out.seekp(offsetof(Header, sourceModifiedTime));
+    out.write(reinterpret_cast<const char *>(&modifiedTime),
+              sizeof(modifiedTime));
+
+    return out.good();
+}
+
+uint32_t flags(bool optimized) noexcept
+{
+    return optimized ? Constant::optimizedFlag : 0;
+}
+
+} // namespace Detail
+
+std::string cacheFileName(const char *model)
+{
+    return std::string{model} + Detail::Constant::extension;
+}
+
+bool load(const char *model, bool optimized, MeshData &data,
+          MeshOptimizer::Report &report)
+{
+    PROGRAM_PROFILE_ZONE("MeshCache::load");
+
+    Detail::SourceStatus status;
+    if (!Detail::sourceStatus(model, status))
+    {
+        return false;
+    }
+
+    const auto fileName{cacheFileName(model)};
+    FileIO::MappedFile file{fileName.c_str()};
+    if (!file.isOpen() || file.size() < sizeof(Detail::Header))
+    {
+        return false;
+    }
+
+    Detail::Header header;
+    std::memcpy(&header, file.data(), sizeof(header));
+
+    if (!Detail::isCompatible(header, file.size()) ||
+        header.flags != Detail::flags(optimized) ||
+        header.sourceSize != status.size)
+    {
+        return false;
+    }
+
+    if (header.sourceModifiedTime != status.modifiedTime)
+    {
+        // Touched but maybe not changed, e.g. after a checkout.
+        FileIO::MappedFile source{model};
+        if (!source.isOpen() ||
+            Detail::contentHash(source.data(), source.size()) !=
+                header.contentHash)
+        {
+            return false;
+        }
+
+        Detail::updateModifiedTime(fileName, status.modifiedTime);
+    }
+
+    const auto vertexCount{static_cast<size_t>(header.vertexCount)};
+    const auto indexCount{static_cast<size_t>(header.indexCount)};
+    const size_t vertexOffset{sizeof(Detail::Header)};
+    const size_t indexOffset{vertexOffset + vertexCount * sizeof(Vertex)};
+
+    if (!Detail::isInRange(reinterpret_cast<const MeshData::IndexType *>(
+                               file.data() + indexOffset),
+                           indexCount, vertexCount))
+    {
+        return false;
+    }
+
+    BoundingBox boundingBox{
+        glm::vec3{header.minimum[0], header.minimum[1], header.minimum[2]},
+        glm::vec3{header.maximum[0], header.maximum[1], header.maximum[2]}};
+
+    BoundingSphere boundingSphere{
+        glm::vec3{header.sphere[0], header.sphere[1], header.sphere[2]},
+        header.sphere[3]};
+
+    data = MeshData{std::move(file), vertexOffset, vertexCount, indexOffset,
+                    indexCount,      boundingBox,  boundingSphere};
+
+    report.optimized = optimized;
+    report.missRatioBefore = header.missRatioBefore;
+    report.missRatioAfter = header.missRatioAfter;
+
+    return true;
+}
+
+bool save(const char *model, const char *source, size_t size,
+          const MeshOptimizer::Report &report, const MeshData &data)
+{
+    PROGRAM_PROFILE_ZONE("MeshCache::save");
+
+    Detail::SourceStatus status;
+    if (!Detail::sourceStatus(model, status) || status.size != size)
+    {
+        return false;
+    }
+
+    const auto &boundingBox{data.boundingBox()};
+    const auto &boundingSphere{data.boundingSphere()};
+
+    Detail::Header header;
+    std::memset(&header, 0, sizeof(header));
+    header.magic = Detail::Constant::magic;
+    header.version = Detail::Constant::version;
+    header.vertexSize = sizeof(Vertex);
+    header.indexSize = sizeof(MeshData::IndexType);
+    header.flags = Detail::flags(report.optimized);
+    header.sourceSize = status.size;
+    header.sourceModifiedTime = status.modifiedTime;
+    header.contentHash = Detail::contentHash(source, size);
+    header.vertexCount = data.vertexCount();
+    header.indexCount = data.indexCount();
+    for (int i{0}; i < 3; ++i)
+    {
+        header.minimum[i] = boundingBox.minimum[i];
+        header.maximum[i] = boundingBox.maximum[i];
+        header.sphere[i] = boundingSphere.center[i];
+    }
+    header.sphere[3] = boundingSphere.radius;
+    header.missRatioBefore = report.missRatioBefore;
+    header.missRatioAfter = report.missRatioAfter;
+
+    const auto fileName{cacheFileName(model)};
+    const auto temporaryName{fileName + Detail::Constant::temporaryExtension};
+
+    std::ofstream out(temporaryName,
+                      std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!out.is_open())
+    {
+        return false;
+    }
+
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char *>(data.vertices()),
+              static_cast<std::streamsize>(sizeof(Vertex) *
+                                           data.vertexCount()));
+    out.write(reinterpret_cast<const char *>(data.indices()),
+              static_cast<std::streamsize>(sizeof(MeshData::IndexType) *
+                                           data.indexCount()));
+    out.close();
+
+    if (!out.good())
+    {
+        std::remove(temporaryName.c_str());
+        return false;
+    }
+
+    // Replace the old entry in one step so a reader never sees half a file.
+    if (std::rename(temporaryName.c_str(), fileName.c_str()) != 0)
+    {
+        std::remove(fileName.c_str());
+        if (std::rename(temporaryName.c_str(), fileName.c_str()) != 0)
+        {
+            std::remove(temporaryName.c_str());
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace MeshCache
+
+} // namespace Model
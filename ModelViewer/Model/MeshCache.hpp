@@ -0,0 +1,44 @@
+#ifndef MODELVIEWER_MODEL_MESHCACHE_HPP_
+#define MODELVIEWER_MODEL_MESHCACHE_HPP_
+
+#include "MeshData.hpp"
+#include "MeshOptimizer.hpp"
+
+#include <cstddef>
+#include <string>
+
+namespace Model
+{
+
+/*
+ * Binary cache of the deduplicated mesh, stored next to the source model as
+ * "<model>.meshcache". An entry is keyed by the size, the modification time
+ * and the content hash of the source. When only the modification time
+ * differs, the source is hashed again before the entry is rejected.
+ */
+namespace MeshCache
+{
+
+std::string cacheFileName(const char *model);
+
+/*
+ * Map the cache entry of model into data, and its optimizer report into
+ * report. Return false if there is no entry, the entry is out of date, was
+ * not stored with the same optimized flag or has an index past its vertices.
+ */
+bool load(const char *model, bool optimized, MeshData &data,
+          MeshOptimizer::Report &report);
+
+/*
+ * Store data as the cache entry of model. source and size are the content
+ * data was parsed from, report tells if and how well MeshOptimizer ran on
+ * data.
+ */
+bool save(const char *model, const char *source, size_t size,
+          const MeshOptimizer::Report &report, const MeshData &data);
+
+} // namespace MeshCache
+
+} // namespace Model
+
+#endif // MODELVIEWER_MODEL_MESHCACHE_HPP_
@@ -0,0 +1,106 @@
+#include "MeshData.hpp"
+
+#include "glm/common.hpp"
+#include "glm/geometric.hpp"
+
+#include <cmath>
+
+#include <algorithm>
+
+namespace Model
+{
+
+MeshData::MeshData() noexcept
+    : vertexBuffer_{}, indexBuffer_{}, file_{}, vertices_{nullptr},
+      vertexCount_{0}, indices_{nullptr}, indexCount_{0},
+      boundingBox_{glm::vec3{0.0f}, glm::vec3{0.0f}},
+      boundingSphere_{glm::vec3{0.0f}, 0.0f}
+{
+}
+
+MeshData::MeshData(std::vector<Vertex> &&vertices,
+                   std::vector<IndexType> &&indices)
+    : vertexBuffer_{std::move(vertices)}, indexBuffer_{std::move(indices)},
+      file_{}, vertices_{vertexBuffer_.data()},
+      vertexCount_{vertexBuffer_.size()}, indices_{indexBuffer_.data()},
+      indexCount_{indexBuffer_.size()},
+      boundingBox_{computeBoundingBox(vertexBuffer_)},
+      boundingSphere_{computeBoundingSphere(vertexBuffer_, boundingBox_)}
+{
+}
+
+MeshData::MeshData(FileIO::MappedFile &&file, size_t vertexOffset,
+                   size_t vertexCount, size_t indexOffset, size_t indexCount,
+                   const BoundingBox &boundingBox,
+                   const BoundingSphere &boundingSphere)
+    : vertexBuffer_{}, indexBuffer_{}, file_{std::move(file)},
+      vertices_{reinterpret_cast<const Vertex *>(file_.data() + vertexOffset)},
+      vertexCount_{vertexCount},
+      indices_{
+          reinterpret_cast<const IndexType *>(file_.data() + indexOffset)},
+      indexCount_{indexCount}, boundingBox_{boundingBox},
+      boundingSphere_{boundingSphere}
+{
+}
+
+MeshData::MeshData(MeshData &&other) noexcept = default;
+
+MeshData &MeshData::operator=(MeshData &&other) noexcept = default;
+
+MeshData::~MeshData() = default;
+
+const Vertex *MeshData::vertices() const noexcept { return vertices_; }
+
+size_t MeshData::vertexCount() const noexcept { return vertexCount_; }
+
+const MeshData::IndexType *MeshData::indices() const noexcept
+{
+    return indices_;
+}
+
+size_t MeshData::indexCount() const noexcept { return indexCount_; }
+
+const BoundingBox &MeshData::boundingBox() const noexcept
+{
+    return boundingBox_;
+}
+
+const BoundingSphere &MeshData::boundingSphere() const noexcept
+{
+    return boundingSphere_;
+}
+
+BoundingBox MeshData::computeBoundingBox(const std::vector<Vertex> &vertices)
+{
+    if (vertices.empty())
+    {
+        return BoundingBox{glm::vec3{0.0f}, glm::vec3{0.0f}};
+    }
+
+    BoundingBox box{vertices.front().position, vertices.front().position};
+    for (const auto &vertex : vertices)
+    {
+        box.minimum = glm::min(box.minimum, vertex.position);
+        box.maximum = glm::max(box.maximum, vertex.position);
+    }
+
+    return box;
+}
+
+BoundingSphere
+MeshData::computeBoundingSphere(const std::vector<Vertex> &vertices,
+                                const BoundingBox &boundingBox)
+{
+    const auto center{(boundingBox.minimum + boundingBox.maximum) * 0.5f};
+
+    float radiusSquared{0.0f};
+    for (const auto &vertex : vertices)
+    {
+        const auto offset{vertex.position - center};
+        radiusSquared = std::max(radiusSquared, glm::dot(offset, offset));
+    }
+
+    return BoundingSphere{center, std::sqrt(radiusSquared)};
+}
+
+} // namespace Model
@@ -0,0 +1,74 @@
+#ifndef MODELVIEWER_MODEL_MESHDATA_HPP_
+#define MODELVIEWER_MODEL_MESHDATA_HPP_
+
+#include "BoundingBox.hpp"
+#include "BoundingSphere.hpp"
+#include "Vertex.hpp"
+
+#include "FileIO/MappedFile.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace Model
+{
+
+/*
+ * Deduplicated vertices and indices ready to upload. The arrays either live
+ * in vectors owned by the instance or point into a mapped mesh cache file.
+ */
+class MeshData
+{
+public:
+    using IndexType = unsigned int;
+
+    explicit MeshData() noexcept;
+    explicit MeshData(std::vector<Vertex> &&vertices,
+                      std::vector<IndexType> &&indices);
+    explicit MeshData(FileIO::MappedFile &&file, size_t vertexOffset,
+                      size_t vertexCount, size_t indexOffset,
+                      size_t indexCount, const BoundingBox &boundingBox,
+                      const BoundingSphere &boundingSphere);
+
+    MeshData(MeshData &&other) noexcept;
+    MeshData &operator=(MeshData &&other) noexcept;
+    ~MeshData();
+
+    MeshData(const MeshData &other) = delete;
+    MeshData &operator=(const MeshData &other) = delete;
+
+    const Vertex *vertices() const noexcept;
+    size_t vertexCount() const noexcept;
+
+    const IndexType *indices() const noexcept;
+    size_t indexCount() const noexcept;
+
+    const BoundingBox &boundingBox() const noexcept;
+    const BoundingSphere &boundingSphere() const noexcept;
+
+    static BoundingBox computeBoundingBox(const std::vector<Vertex> &vertices);
+
+    /*
+     * The sphere is centered on the box, so both share the same center.
+     */
+    static BoundingSphere
+    computeBoundingSphere(const std::vector<Vertex> &vertices,
+                          const BoundingBox &boundingBox);
+
+private:
+    std::vector<Vertex> vertexBuffer_;
+    std::vector<IndexType> indexBuffer_;
+    FileIO::MappedFile file_;
+
+    const Vertex *vertices_;
+    size_t vertexCount_;
+    const IndexType *indices_;
+    size_t indexCount_;
+
+    BoundingBox boundingBox_;
+    BoundingSphere boundingSphere_;
+};
+
+} // namespace Model
+
+#endif // MODELVIEWER_MODEL_MESHDATA_HPP_
@@ -0,0 +1,266 @@
+#include "MeshOptimizer.hpp"
+
+#include "Profiler/Profiler.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+namespace Model
+{
+
+namespace MeshOptimizer
+{
+
+namespace Detail
+{
+
+namespace Constant
+{
+
+constexpr size_t noVertex{std::numeric_limits<size_t>::max()};
+constexpr IndexType unmapped{std::numeric_limits<IndexType>::max()};
+
+} // namespace Constant
+
+/*
+ * Triangles using each vertex, stored as one array with an offset table.
+ */
+struct Adjacency
+{
+    std::vector<size_t> offsets;
+    std::vector<size_t> triangles;
+};
+
+Adjacency buildAdjacency(const std::vector<IndexType> &indices,
+                         size_t vertexCount);
+size_t nextVertex(const std::vector<size_t> &candidates,
+                  const std::vector<size_t> &liveCount,
+                  const std::vector<size_t> &cacheTime, size_t timestamp,
+                  size_t cacheSize, std::vector<size_t> &deadEnd,
+                  size_t &cursor);
+
+Adjacency buildAdjacency(const std::vector<IndexType> &indices,
+                         size_t vertexCount)
+{
+    Adjacency adjacency;
+    adjacency.offsets.assign(vertexCount + 1, 0);
+
+    for (const auto index : indices)
+    {
+        ++adjacency.offsets[static_cast<size_t>(index) + 1];
+    }
+
+    for (size_t v{0}; v < vertexCount; ++v)
+    {
+        adjacency.offsets[v + 1] += adjacency.offsets[v];
+    }
+
+    adjacency.triangles.resize(indices.size());
+    std::vector<size_t> fill{adjacency.offsets.begin(),
+                             adjacency.offsets.end() - 1};
+
+    for (size_t i{0}; i < indices.size(); ++i)
+    {
+        adjacency.triangles[fill[static_cast<size_t>(indices[i])]++] = i / 3;
+    }
+
+    return adjacency;
+}
+
+size_t nextVertex(const std::vector<size_t> &candidates,
+                  const std::vector<size_t> &liveCount,
+                  const std::vector<size_t> &cacheTime, size_t timestamp,
+                  size_t cacheSize, std::vector<size_t> &deadEnd,
+                  size_t &cursor)
+{
+    // Prefer the candidate staying in the cache the longest after its
+    // remaining triangles are emitted.
+    size_t best{Constant::noVertex};
+    size_t bestPriority{0};
+
+    for (const auto v : candidates)
+    {
+        if (liveCount[v] == 0)
+        {
+            continue;
+        }
+
+        size_t priority{0};
+        const size_t age{timestamp - cacheTime[v]};
+        if (age + 2 * liveCount[v] <= cacheSize)
+        {
+            priority = age;
+        }
+
+        if (best == Constant::noVertex || priority > bestPriority)
+        {
+            best = v;
+            bestPriority = priority;
+        }
+    }
+
+    if (best != Constant::noVertex)
+    {
+        return best;
+    }
+
+    while (!deadEnd.empty())
+    {
+        const size_t v{deadEnd.back()};
+        deadEnd.pop_back();
+
+        if (liveCount[v] > 0)
+        {
+            return v;
+        }
+    }
+
+    for (; cursor < liveCount.size(); ++cursor)
+    {
+        if (liveCount[cursor] > 0)
+        {
+            return cursor;
+        }
+    }
+
+    return Constant::noVertex;
+}
+
+} // namespace Detail
+
+double averageCacheMissRatio(const std::vector<IndexType> &indices,
+                             size_t vertexCount, size_t cacheSize)
+{
+    if (indices.size() < 3)
+    {
+        return 0.0;
+    }
+
+    // A vertex is cached if it entered the FIFO less than cacheSize misses ago.
+    std::vector<size_t> enteredAt(vertexCount, 0);
+    size_t misses{0};
+
+    for (const auto index : indices)
+    {
+        auto &entered{enteredAt[static_cast<size_t>(index)]};
+        if (entered == 0 || misses + 1 - entered > cacheSize)
+        {
+            ++misses;
+            entered = misses;
+        }
+    }
+
+    return static_cast<double>(misses) /
+           static_cast<double>(indices.size() / 3);
+}
+
+void optimizeVertexCache(std::vector<IndexType> &indices, size_t vertexCount,
+                         size_t cacheSize)
+{
+    const size_t triangleCount{indices.size() / 3};
+    if (triangleCount == 0 || vertexCount == 0)
+    {
+        return;
+    }
+
+    const auto adjacency{Detail::buildAdjacency(indices, vertexCount)};
+
+    std::vector<size_t> liveCount(vertexCount);
+    for (size_t v{0}; v < vertexCount; ++v)
+    {
+        liveCount[v] = adjacency.offsets[v + 1] - adjacency.offsets[v];
+    }
+
+    std::vector<size_t> cacheTime(vertexCount, 0);
+    std::vector<uint8_t> emitted(triangleCount, 0);
+    std::vector<size_t> deadEnd;
+    std::vector<size_t> candidates;
+
+    std::vector<IndexType> output;
+    output.reserve(indices.size());
+
+    size_t timestamp{cacheSize + 1};
+    size_t cursor{1};
+    size_t fanning{0};
+
+    while (fanning != Detail::Constant::noVertex)
+    {
+        candidates.clear();
+
+        for (size_t i{adjacency.offsets[fanning]};
+             i < adjacency.offsets[fanning + 1]; ++i)
+        {
+            const size_t triangle{adjacency.triangles[i]};
+            if (emitted[triangle])
+            {
+                continue;
+            }
+
+            for (size_t corner{0}; corner < 3; ++corner)
+            {
+                const auto index{indices[3 * triangle + corner]};
+                const auto v{static_cast<size_t>(index)};
+
+                output.push_back(index);
+                deadEnd.push_back(v);
+                candidates.push_back(v);
+                --liveCount[v];
+
+                if (timestamp - cacheTime[v] > cacheSize)
+                {
+                    cacheTime[v] = timestamp++;
+                }
+            }
+
+            emitted[triangle] = 1;
+        }
+
+        fanning = Detail::nextVertex(candidates, liveCount, cacheTime,
+                                     timestamp, cacheSize, deadEnd, cursor);
+    }
+
+    indices.swap(output);
+}
+
+void optimizeVertexFetch(std::vector<Vertex> &vertices,
+                         std::vector<IndexType> &indices)
+{
+    std::vector<IndexType> remap(vertices.size(), Detail::Constant::unmapped);
+    std::vector<Vertex> output;
+    output.reserve(vertices.size());
+
+    for (auto &index : indices)
+    {
+        auto &mapped{remap[static_cast<size_t>(index)]};
+        if (mapped == Detail::Constant::unmapped)
+        {
+            mapped = static_cast<IndexType>(output.size());
+            output.push_back(vertices[static_cast<size_t>(index)]);
+        }
+
+        index = mapped;
+    }
+
+    vertices.swap(output);
+}
+
+Report optimize(std::vector<Vertex> &vertices, std::vector<IndexType> &indices)
+{
+    PROGRAM_PROFILE_ZONE("MeshOptimizer::optimize");
+
+    Report report;
+    report.optimized = true;
+    report.missRatioBefore = averageCacheMissRatio(indices, vertices.size());
+
+    optimizeVertexCache(indices, vertices.size());
+    optimizeVertexFetch(vertices, indices);
+
+    report.missRatioAfter = averageCacheMissRatio(indices, vertices.size());
+
+    return report;
+}
+
+} // namespace MeshOptimizer
+
+} // namespace Model
@@ -0,0 +1,56 @@
+#ifndef MODELVIEWER_MODEL_MESHOPTIMIZER_HPP_
+#define MODELVIEWER_MODEL_MESHOPTIMIZER_HPP_
+
+#include "Vertex.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace Model
+{
+
+namespace MeshOptimizer
+{
+
+using IndexType = unsigned int;
+
+struct Report
+{
+    bool optimized;
+    double missRatioBefore;
+    double missRatioAfter;
+};
+
+/*
+ * Average cache miss ratio: transformed vertices per triangle, simulated with
+ * a FIFO post-transform cache of cacheSize entries. 0.5 is the ideal value for
+ * a regular grid, 3 means no reuse at all.
+ */
+double averageCacheMissRatio(const std::vector<IndexType> &indices,
+                             size_t vertexCount, size_t cacheSize = 16);
+
+/*
+ * Reorder the triangles for post-transform cache reuse (Tipsify, Sander et al.
+ * 2007). The vertices are left untouched.
+ */
+void optimizeVertexCache(std::vector<IndexType> &indices, size_t vertexCount,
+                         size_t cacheSize = 16);
+
+/*
+ * Renumber the vertices in order of first use, so the vertex fetches walk the
+ * buffer forward. Unreferenced vertices are dropped.
+ */
+void optimizeVertexFetch(std::vector<Vertex> &vertices,
+                         std::vector<IndexType> &indices);
+
+/*
+ * Run both passes and measure the miss ratio before and after.
+ */
+Report optimize(std::vector<Vertex> &vertices,
+                std::vector<IndexType> &indices);
+
+} // namespace MeshOptimizer
+
+} // namespace Model
+
+#endif // MODELVIEWER_MODEL_MESHOPTIMIZER_HPP_
@@ -1,9 +1,14 @@
 #include "ModelFactory.hpp"
 
+#include "FileIO/MappedFile.hpp"
 #include "Hash/Hash.hpp"
+#include "MeshCache.hpp"
+#include "ObjParser.hpp"
+#include "Profiler/Profiler.hpp"
 #include "Utils/PreDefine.hpp"
+#include "Utils/StringFormat/StringFormat.hpp"
 #include "Vertex.hpp"
-#include "VertexMap.hpp"
+#include "VertexDeduplication.hpp"
 
 PRAGMA_WARNING_PUSH
 PRAGMA_WARNING_DISABLE_DOUBLEPROMOTION
@@ -12,9 +17,8 @@ PRAGMA_WARNING_DISABLE_DOUBLEPROMOTION
 
 PRAGMA_WARNING_POP
 
-#include "tiny_obj_loader.h"
-
 #include <iostream>
+#include <mutex>
 #include <unordered_map>
 
 namespace Model
@@ -23,53 +27,50 @@ namespace Model
 namespace Detail
 {
 
-void getData(const tinyobj::attrib_t &attribute,
-             const std::vector<tinyobj::shape_t> &shapes,
-             std::vector<Vertex> &vertices, std::vector<unsigned int> &indices);
-Vertex getVertex(const tinyobj::attrib_t &attribute, tinyobj::index_t &index);
+void getData(const Obj::Data &data, std::vector<Vertex> &vertices,
+             std::vector<unsigned int> &indices);
+Vertex getVertex(const Obj::Data &data, const Obj::Index &index);
 GLenum rgbFormat(int channels) noexcept;
 
-void getData(const tinyobj::attrib_t &attribute,
-             const std::vector<tinyobj::shape_t> &shapes,
-             std::vector<Vertex> &vertices, std::vector<unsigned int> &indices)
+std::once_flag flipOnLoad;
+
+void getData(const Obj::Data &data, std::vector<Vertex> &vertices,
+             std::vector<unsigned int> &indices)
 {
-    VertexMap<Vertex, GLuint> map;
+    deduplicate(
+        data.indices.size(),
+        [&data](size_t i) { return getVertex(data, data.indices[i]); },
+        vertices, indices);
+}
 
-    for (auto &shape : shapes)
-    {
-        size_t indexOffset{0};
+Vertex getVertex(const Obj::Data &data, const Obj::Index &index)
+{
+    auto position{glm::vec3{
+        data.vertices[static_cast<size_t>(3 * index.vertex + 0)],
+        data.vertices[static_cast<size_t>(3 * index.vertex + 1)],
+        data.vertices[static_cast<size_t>(3 * index.vertex + 2)]}};
 
-        for (auto &faceVertices : shape.mesh.num_face_vertices)
-        {
-            size_t castedFaceVertices{static_cast<size_t>(faceVertices)};
-            for (size_t v{0}; v < castedFaceVertices; ++v)
-            {
-                auto index{shape.mesh.indices[indexOffset + v]};
-                auto vertex{getVertex(attribute, index)};
-                map.insert(vertex);
-            }
-
-            indexOffset += castedFaceVertices;
-        }
+    auto normal{glm::vec3{0.0f}};
+    if (index.normal >= 0)
+    {
+        normal = glm::vec3{
+            data.normals[static_cast<size_t>(3 * index.normal + 0)],
+            data.normals[static_cast<size_t>(3 * index.normal + 1)],
+            data.normals[static_cast<size_t>(3 * index.normal + 2)]};
     }
 
-    map.getVertices(vertices);
-    map.getIndices(indices);
-}
+    auto texture{glm::vec2{0.0f}};
+    if (index.textureCoordinate >= 0)
+    {
+        texture = glm::vec2{
+            data.textureCoordinates[static_cast<size_t>(
+                2 * index.textureCoordinate + 0)],
+            data.textureCoordinates[static_cast<size_t>(
+                2 * index.textureCoordinate + 1)]};
+    }
 
-Vertex getVertex(const tinyobj::attrib_t &attribute, tinyobj::index_t &index)
-{
-    auto vx{attribute.vertices[3 * index.vertex_index + 0]};
-    auto vy{attribute.vertices[3 * index.vertex_index + 1]};
-    auto vz{attribute.vertices[3 * index.vertex_index + 2]};
-    auto nx{attribute.normals[3 * index.normal_index + 0]};
-    auto ny{attribute.normals[3 * index.normal_index + 1]};
-    auto nz{attribute.normals[3 * index.normal_index + 2]};
-    auto tx{attribute.texcoords[2 * index.texcoord_index + 0]};
-    auto ty{attribute.texcoords[2 * index.texcoord_index + 1]};
-
-    return Model::Vertex{glm::vec3{vx, vy, vz}, glm::vec3{nx, ny, nz},
-                         glm::vec2{tx, ty}};
+    // Fold -0 into +0, equal vertices must hash equally to be deduplicated.
+    return Model::Vertex{position + 0.0f, normal + 0.0f, texture + 0.0f};
 }
 
 GLenum rgbFormat(int channels) noexcept
@@ -90,49 +91,127 @@ GLenum rgbFormat(int channels) noexcept
 
 } // namespace Detail
 
-std::unique_ptr<OpenGL::OpenGLTexture>
-ModelFactory::loadTextureFromFile(const char *fileName)
+bool ModelFactory::loadImageFromFile(const char *fileName, ImageData &image)
 {
+    PROGRAM_PROFILE_ZONE("ModelFactory::loadImageFromFile");
+
+    std::call_once(Detail::flipOnLoad,
+                   []() { stbi_set_flip_vertically_on_load(true); });
+
     int width, height, channels;
-    stbi_set_flip_vertically_on_load(true);
     unsigned char *data{stbi_load(fileName, &width, &height, &channels, 0)};
 
     if (!data)
     {
-        return std::make_unique<OpenGL::OpenGLTexture>();
+        return false;
     }
 
     const size_t size{static_cast<size_t>(width * height * channels)};
 
-    std::vector<unsigned char> buffer{data, data + size};
+    image.width = width;
+    image.height = height;
+    image.format = Detail::rgbFormat(channels);
+    image.pixels.assign(data, data + size);
     stbi_image_free(data);
 
-    return std::make_unique<OpenGL::OpenGLTexture>(
-        width, height, Detail::rgbFormat(channels), buffer);
+    return true;
 }
 
-std::unique_ptr<Mesh> ModelFactory::loadMeshFromFile(
-    const char *model, std::string &warning, std::string &error,
-    OpenGL::OpenGLShaderProgram &program, OpenGL::OpenGLTexture *texture)
+bool ModelFactory::loadMeshDataFromFile(const char *model, MeshData &data,
+                                        std::string &warning,
+                                        std::string &error, bool optimize,
+                                        MeshOptimizer::Report *report)
 {
-    tinyobj::attrib_t attribute;
-    std::vector<tinyobj::shape_t> shapes;
-    std::vector<tinyobj::material_t> materials;
+    PROGRAM_PROFILE_ZONE("ModelFactory::loadMeshDataFromFile");
+
+    MeshOptimizer::Report optimized{false, 0.0, 0.0};
+    if (MeshCache::load(model, optimize, data, optimized))
+    {
+        if (report)
+        {
+            *report = optimized;
+        }
+        return true;
+    }
 
-    auto loadStatus = tinyobj::LoadObj(&attribute, &shapes, &materials,
-                                       &warning, &error, model);
+    FileIO::MappedFile source{model};
+    if (!source.isOpen())
+    {
+        error += StringFormat::StringFormat("Cannot open file [%s].\n", model);
+        return false;
+    }
 
-    if (!loadStatus)
+    Obj::Data objData;
+    if (!Obj::parse(source.data(), source.size(), objData, warning, error))
     {
-        return nullptr;
+        return false;
     }
 
     std::vector<unsigned int> indices;
     std::vector<Vertex> vertices;
 
-    Detail::getData(attribute, shapes, vertices, indices);
+    Detail::getData(objData, vertices, indices);
+
+    if (optimize)
+    {
+        optimized = MeshOptimizer::optimize(vertices, indices);
+    }
+
+    if (report)
+    {
+        *report = optimized;
+    }
+
+    data = MeshData{std::move(vertices), std::move(indices)};
+    if (!MeshCache::save(model, source.data(), source.size(), optimized,
+                         data))
+    {
+        warning += StringFormat::StringFormat(
+            "Cannot write mesh cache [%s].\n",
+            MeshCache::cacheFileName(model).c_str());
+    }
+
+    return true;
+}
+
+std::unique_ptr<OpenGL::OpenGLTexture>
+ModelFactory::createTexture(const ImageData &image)
+{
+    return std::make_unique<OpenGL::OpenGLTexture>(image.width, image.height,
+                                                   image.format, image.pixels);
+}
+
+std::unique_ptr<Mesh>
+ModelFactory::createMesh(const MeshData &data,
+                         OpenGL::OpenGLShaderProgram &program,
+                         OpenGL::OpenGLTexture *texture)
+{
+    return std::make_unique<Model::Mesh>(data, program, texture);
+}
+
+std::unique_ptr<OpenGL::OpenGLTexture>
+ModelFactory::loadTextureFromFile(const char *fileName)
+{
+    ImageData image;
+    if (!loadImageFromFile(fileName, image))
+    {
+        return std::make_unique<OpenGL::OpenGLTexture>();
+    }
+
+    return createTexture(image);
+}
+
+std::unique_ptr<Mesh> ModelFactory::loadMeshFromFile(
+    const char *model, std::string &warning, std::string &error,
+    OpenGL::OpenGLShaderProgram &program, OpenGL::OpenGLTexture *texture)
+{
+    MeshData data;
+    if (!loadMeshDataFromFile(model, data, warning, error))
+    {
+        return nullptr;
+    }
 
-    return std::make_unique<Model::Mesh>(vertices, indices, program, texture);
+    return createMesh(data, program, texture);
 }
 
 } // namespace Model
@@ -1,7 +1,10 @@
 #ifndef MODELVIEWER_MODEL_MODELFACTORY_HPP_
 #define MODELVIEWER_MODEL_MODELFACTORY_HPP_
 
+#include "ImageData.hpp"
 #include "Mesh.hpp"
+#include "MeshData.hpp"
+#include "MeshOptimizer.hpp"
 #include "OpenGL/OpenGLTexture.hpp"
 
 #include <memory>
@@ -10,9 +13,34 @@
 namespace Model
 {
 
+/*
+ * The load functions only touch the CPU and are safe to call on any thread.
+ * The create functions upload to OpenGL and must run on the thread owning the
+ * context.
+ */
 class ModelFactory
 {
 public:
+    static bool loadImageFromFile(const char *fileName, ImageData &image);
+
+    /*
+     * optimize reorders the mesh for the post-transform vertex cache, the
+     * gain is written to report. The cache entry keeps the gain measured when
+     * the mesh was parsed.
+     */
+    static bool
+    loadMeshDataFromFile(const char *model, MeshData &data,
+                         std::string &warning, std::string &error,
+                         bool optimize = true,
+                         MeshOptimizer::Report *report = nullptr);
+
+    static std::unique_ptr<OpenGL::OpenGLTexture>
+    createTexture(const ImageData &image);
+
+    static std::unique_ptr<Mesh>
+    createMesh(const MeshData &data, OpenGL::OpenGLShaderProgram &program,
+               OpenGL::OpenGLTexture *texture = nullptr);
+
     static std::unique_ptr<OpenGL::OpenGLTexture>
     loadTextureFromFile(const char *fileName);
 
@@ -0,0 +1,650 @@
+#include "ObjParser.hpp"
+
+#include "FileIO/MappedFile.hpp"
+#include "Profiler/Profiler.hpp"
+#include "Utils/Parallel/Parallel.hpp"
+#include "Utils/StringFormat/StringFormat.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+#include <algorithm>
+
+namespace Model
+{
+
+namespace Obj
+{
+
+namespace Detail
+{
+
+namespace Constant
+{
+
+constexpr size_t minimumChunkSize{1 << 20};
+constexpr size_t chunksPerThread{4};
+constexpr int missingIndex{-1};
+constexpr uint64_t maxMantissa{1000000000000000000ULL};
+constexpr int maxExponent{10000};
+
+} // namespace Constant
+
+enum Component : size_t
+{
+    VertexComponent = 0,
+    NormalComponent = 1,
+    TextureCoordinateComponent = 2,
+    ComponentCount = 3
+};
+
+// One bit per Component in relative and present.
+struct Corner
+{
+    Index index;
+    unsigned char relative;
+    unsigned char present;
+};
+
+struct Chunk
+{
+    const char *begin;
+    const char *end;
+
+    Data data;
+
+    // Position of each index which is relative to the chunk. The position is
+    // indices offset * ComponentCount + Component.
+    std::vector<size_t> relativeSlots;
+
+    // Components given by each index, a resolved index may be any value so
+    // it cannot tell a missing component.
+    std::vector<unsigned char> presentComponents;
+
+    size_t skippedFaces;
+    const char *errorPosition;
+    bool invalidIndex;
+};
+
+bool isDigit(char c) noexcept;
+bool isSpace(char c) noexcept;
+double power10(int exponent) noexcept;
+const char *skipSpace(const char *p, const char *end) noexcept;
+bool parseFloat(const char *&p, const char *end, float &value) noexcept;
+bool parseInt(const char *&p, const char *end, int &value) noexcept;
+bool resolveIndex(int raw, size_t count, int &index, Corner &corner,
+                  Component component) noexcept;
+bool parseCorner(const char *&p, const char *end, const Data &data,
+                 Corner &corner) noexcept;
+bool parseFloats(const char *p, const char *end, std::vector<float> &output,
+                 size_t required, size_t optional);
+bool parseFace(const char *p, const char *end, Chunk &chunk,
+               std::vector<Corner> &face);
+bool parseLine(const char *p, const char *end, Chunk &chunk,
+               std::vector<Corner> &face);
+void parseChunk(Chunk &chunk);
+std::vector<Chunk> splitChunks(const char *text, size_t size);
+int &component(Index &index, size_t component) noexcept;
+bool isValid(const Index &index, unsigned char present,
+             const Data &data) noexcept;
+size_t lineNumber(const char *text, const char *position) noexcept;
+void merge(std::vector<Chunk> &chunks, Data &data);
+
+bool isDigit(char c) noexcept { return c >= '0' && c <= '9'; }
+
+bool isSpace(char c) noexcept { return c == ' ' || c == '\t' || c == '\r'; }
+
+double power10(int exponent) noexcept
+{
+    static const double exact[]{1e0,  1e1,  1e2,  1e3,  1e4,  1e5,
+                                1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                1e12, 1e13, 1e14, 1e15, 1e16, 1e17,
+                                1e18, 1e19, 1e20, 1e21, 1e22};
+
+    if (exponent >= 0 &&
+        exponent < static_cast<int>(sizeof(exact) / sizeof(exact[0])))
+    {
+        return exact[exponent];
+    }
+
+    return std::pow(10.0, exponent);
+}
+
+const char *skipSpace(const char *p, const char *end) noexcept
+{
+    while (p != end && isSpace(*p))
+    {
+        ++p;
+    }
+    return p;
+}
+
+bool parseFloat(const char *&p, const char *end, float &value) noexcept
+{
+    const char *c{p};
+
+    bool negative{false};
+    if (c != end && (*c == '-' || *c == '+'))
+    {
+        negative = (*c == '-');
+        ++c;
+    }
+
+    uint64_t mantissa{0};
+    int exponent{0};
+    bool hasDigits{false};
+
+    for (; c != end && isDigit(*c); ++c)
+    {
+        hasDigits = true;
+        if (mantissa < Constant::maxMantissa)
+        {
+            mantissa = mantissa * 10 + static_cast<uint64_t>(*c - '0');
+        }
+        else
+        {
+            ++exponent;
+        }
+    }
+
+    if (c != end && *c == '.')
+    {
+        for (++c; c != end && isDigit(*c); ++c)
+        {
+            hasDigits = true;
+            if (mantissa < Constant::maxMantissa)
+            {
+                mantissa = mantissa * 10 + static_cast<uint64_t>(*c - '0');
+                --exponent;
+            }
+        }
+    }
+
+    if (!hasDigits)
+    {
+        return false;
+    }
+
+    if (c != end && (*c == 'e' || *c == 'E'))
+    {
+        const char *e{c + 1};
+
+        bool negativeExponent{false};
+        if (e != end && (*e == '-' || *e == '+'))
+        {
+            negativeExponent = (*e == '-');
+            ++e;
+        }
+
+        if (e != end && isDigit(*e))
+        {
+            int explicitExponent{0};
+            for (; e != end && isDigit(*e); ++e)
+            {
+                if (explicitExponent < Constant::maxExponent)
+                {
+                    explicitExponent = explicitExponent * 10 + (*e - '0');
+                }
+            }
+
+            exponent += negativeExponent ? -explicitExponent : explicitExponent;
+            c = e;
+        }
+    }
+
+    double result{static_cast<double>(mantissa)};
+    if (exponent < 0)
+    {
+        result /= power10(-exponent);
+    }
+    else if (exponent > 0)
+    {
+        result *= power10(exponent);
+    }
+
+    value = static_cast<float>(negative ? -result : result);
+    p = c;
+
+    return true;
+}
+
+bool parseInt(const char *&p, const char *end, int &value) noexcept
+{
+    const char *c{p};
+
+    bool negative{false};
+    if (c != end && (*c == '-' || *c == '+'))
+    {
+        negative = (*c == '-');
+        ++c;
+    }
+
+    if (c == end || !isDigit(*c))
+    {
+        return false;
+    }
+
+    long long result{0};
+    for (; c != end && isDigit(*c); ++c)
+    {
+        result = result * 10 + (*c - '0');
+        if (result > INT32_MAX)
+        {
+            return false;
+        }
+    }
+
+    value = static_cast<int>(negative ? -result : result);
+    p = c;
+
+    return true;
+}
+
+bool resolveIndex(int raw, size_t count, int &index, Corner &corner,
+                  Component component) noexcept
+{
+    if (raw > 0)
+    {
+        index = raw - 1;
+        corner.present =
+            static_cast<unsigned char>(corner.present | (1u << component));
+        return true;
+    }
+
+    if (raw < 0)
+    {
+        // Relative to the end of the chunk so far. The chunk base is added
+        // when the chunks are merged.
+        index = static_cast<int>(count) + raw;
+        corner.relative =
+            static_cast<unsigned char>(corner.relative | (1u << component));
+        corner.present =
+            static_cast<unsigned char>(corner.present | (1u << component));
+        return true;
+    }
+
+    return false;
+}
+
+bool parseCorner(const char *&p, const char *end, const Data &data,
+                 Corner &corner) noexcept
+{
+    corner.index.vertex = Constant::missingIndex;
+    corner.index.normal = Constant::missingIndex;
+    corner.index.textureCoordinate = Constant::missingIndex;
+    corner.relative = 0;
+    corner.present = 0;
+
+    int raw;
+    if (!parseInt(p, end, raw) ||
+        !resolveIndex(raw, data.vertices.size() / 3, corner.index.vertex,
+                      corner, VertexComponent))
+    {
+        return false;
+    }
+
+    if (p != end && *p == '/')
+    {
+        ++p;
+        if (p != end && *p != '/')
+        {
+            if (!parseInt(p, end, raw) ||
+                !resolveIndex(raw, data.textureCoordinates.size() / 2,
+                              corner.index.textureCoordinate, corner,
+                              TextureCoordinateComponent))
+            {
+                return false;
+            }
+        }
+
+        if (p != end && *p == '/')
+        {
+            ++p;
+            if (!parseInt(p, end, raw) ||
+                !resolveIndex(raw, data.normals.size() / 3, corner.index.normal,
+                              corner, NormalComponent))
+            {
+                return false;
+            }
+        }
+    }
+
+    return (p == end || isSpace(*p));
+}
+
+bool parseFloats(const char *p, const char *end, std::vector<float> &output,
+                 size_t required, size_t optional)
+{
+    for (size_t i{0}; i < required + optional; ++i)
+    {
+        p = skipSpace(p, end);
+
+        float value{0.0f};
+        if (!parseFloat(p, end, value) && i < required)
+        {
+            return false;
+        }
+
+        output.push_back(value);
+    }
+
+    return true;
+}
+
+bool parseFace(const char *p, const char *end, Chunk &chunk,
+               std::vector<Corner> &face)
+{
+    face.clear();
+
+    for (p = skipSpace(p, end); p != end; p = skipSpace(p, end))
+    {
+        Corner corner;
+        if (!parseCorner(p, end, chunk.data, corner))
+        {
+            return false;
+        }
+        face.push_back(corner);
+    }
+
+    if (face.size() < 3)
+    {
+        ++chunk.skippedFaces;
+        return true;
+    }
+
+    auto &indices{chunk.data.indices};
+
+    auto emit{[&chunk, &indices](const Corner &corner) {
+        for (size_t c{0}; c < ComponentCount; ++c)
+        {
+            if (corner.relative & (1u << c))
+            {
+                chunk.relativeSlots.push_back(indices.size() * ComponentCount +
+                                              c);
+            }
+        }
+        indices.push_back(corner.index);
+        chunk.presentComponents.push_back(corner.present);
+    }};
+
+    // Triangulate the polygon as a fan.
+    for (size_t k{2}; k < face.size(); ++k)
+    {
+        emit(face[0]);
+        emit(face[k - 1]);
+        emit(face[k]);
+    }
+
+    return true;
+}
+
+bool parseLine(const char *p, const char *end, Chunk &chunk,
+               std::vector<Corner> &face)
+{
+    auto isKeyword{[p, end](size_t length) {
+        return (p + length == end || isSpace(p[length]));
+    }};
+
+    if (p[0] == 'v')
+    {
+        if (isKeyword(1))
+        {
+            return parseFloats(p + 1, end, chunk.data.vertices, 3, 0);
+        }
+
+        if (p + 1 != end && p[1] == 'n' && isKeyword(2))
+        {
+            return parseFloats(p + 2, end, chunk.data.normals, 3, 0);
+        }
+
+        if (p + 1 != end && p[1] == 't' && isKeyword(2))
+        {
+            return parseFloats(p + 2, end, chunk.data.textureCoordinates, 1, 1);
+        }
+    }
+    else if (p[0] == 'f' && isKeyword(1))
+    {
+        return parseFace(p + 1, end, chunk, face);
+    }
+
+    return true;
+}
+
+void parseChunk(Chunk &chunk)
+{
+    PROGRAM_PROFILE_ZONE("Obj::parseChunk");
+
+    std::vector<Corner> face;
+
+    const char *line{chunk.begin};
+    while (line != chunk.end)
+    {
+        auto newLine{static_cast<const char *>(std::memchr(
+            line, '\n', static_cast<size_t>(chunk.end - line)))};
+        const char *lineEnd{newLine ? newLine : chunk.end};
+
+        const char *p{skipSpace(line, lineEnd)};
+        if (p != lineEnd && *p != '#' && !parseLine(p, lineEnd, chunk, face))
+        {
+            chunk.errorPosition = line;
+            return;
+        }
+
+        line = newLine ? newLine + 1 : chunk.end;
+    }
+}
+
+std::vector<Chunk> splitChunks(const char *text, size_t size)
+{
+    size_t chunkCount{1};
+    if (size >= 2 * Constant::minimumChunkSize)
+    {
+        chunkCount =
+            std::min(Parallel::threadCount() * Constant::chunksPerThread,
+                     size / Constant::minimumChunkSize);
+    }
+
+    std::vector<Chunk> chunks;
+    chunks.reserve(chunkCount);
+
+    const char *end{text + size};
+    const char *begin{text};
+
+    for (size_t i{1}; i <= chunkCount && begin != end; ++i)
+    {
+        const char *chunkEnd{end};
+
+        if (i != chunkCount)
+        {
+            chunkEnd = std::max(begin, text + size / chunkCount * i);
+
+            // Align the chunk to the end of the line.
+            auto newLine{static_cast<const char *>(std::memchr(
+                chunkEnd, '\n', static_cast<size_t>(end - chunkEnd)))};
+            chunkEnd = newLine ? newLine + 1 : end;
+        }
+
+        chunks.push_back(
+            Chunk{begin, chunkEnd, Data{}, {}, {}, 0, nullptr, false});
+        begin = chunkEnd;
+    }
+
+    return chunks;
+}
+
+int &component(Index &index, size_t component) noexcept
+{
+    switch (component)
+    {
+    case NormalComponent:
+        return index.normal;
+    case TextureCoordinateComponent:
+        return index.textureCoordinate;
+    case VertexComponent:
+    default:
+        return index.vertex;
+    }
+}
+
+bool isValid(const Index &index, unsigned char present,
+             const Data &data) noexcept
+{
+    auto inRange{[present](int i, size_t count, Component component) {
+        return !(present & (1u << component)) ||
+               (i >= 0 && static_cast<size_t>(i) < count);
+    }};
+
+    return (present & (1u << VertexComponent)) &&
+           inRange(index.vertex, data.vertices.size() / 3, VertexComponent) &&
+           inRange(index.normal, data.normals.size() / 3, NormalComponent) &&
+           inRange(index.textureCoordinate, data.textureCoordinates.size() / 2,
+                   TextureCoordinateComponent);
+}
+
+size_t lineNumber(const char *text, const char *position) noexcept
+{
+    return static_cast<size_t>(std::count(text, position, '\n')) + 1;
+}
+
+void merge(std::vector<Chunk> &chunks, Data &data)
+{
+    struct Offset
+    {
+        size_t vertices;
+        size_t normals;
+        size_t textureCoordinates;
+        size_t indices;
+    };
+
+    std::vector<Offset> offsets(chunks.size() + 1, Offset{0, 0, 0, 0});
+    for (size_t i{0}; i < chunks.size(); ++i)
+    {
+        const auto &chunkData{chunks[i].data};
+
+        offsets[i + 1].vertices =
+            offsets[i].vertices + chunkData.vertices.size();
+        offsets[i + 1].normals = offsets[i].normals + chunkData.normals.size();
+        offsets[i + 1].textureCoordinates =
+            offsets[i].textureCoordinates +
+            chunkData.textureCoordinates.size();
+        offsets[i + 1].indices = offsets[i].indices + chunkData.indices.size();
+    }
+
+    const auto &total{offsets.back()};
+    data.vertices.resize(total.vertices);
+    data.normals.resize(total.normals);
+    data.textureCoordinates.resize(total.textureCoordinates);
+    data.indices.resize(total.indices);
+
+    Parallel::forEach(chunks.size(), [&chunks, &offsets, &data](size_t i) {
+        auto &chunk{chunks[i]};
+        auto &chunkData{chunk.data};
+        const auto &offset{offsets[i]};
+
+        const int base[ComponentCount]{
+            static_cast<int>(offset.vertices / 3),
+            static_cast<int>(offset.normals / 3),
+            static_cast<int>(offset.textureCoordinates / 2)};
+
+        for (auto slot : chunk.relativeSlots)
+        {
+            auto c{slot % ComponentCount};
+            component(chunkData.indices[slot / ComponentCount], c) += base[c];
+        }
+
+        std::copy(chunkData.vertices.begin(), chunkData.vertices.end(),
+                  data.vertices.begin() +
+                      static_cast<std::ptrdiff_t>(offset.vertices));
+        std::copy(chunkData.normals.begin(), chunkData.normals.end(),
+                  data.normals.begin() +
+                      static_cast<std::ptrdiff_t>(offset.normals));
+        std::copy(chunkData.textureCoordinates.begin(),
+                  chunkData.textureCoordinates.end(),
+                  data.textureCoordinates.begin() +
+                      static_cast<std::ptrdiff_t>(offset.textureCoordinates));
+
+        auto output{data.indices.begin() +
+                    static_cast<std::ptrdiff_t>(offset.indices)};
+        for (size_t j{0}; j < chunkData.indices.size(); ++j)
+        {
+            const auto &index{chunkData.indices[j]};
+            chunk.invalidIndex =
+                chunk.invalidIndex ||
+                !isValid(index, chunk.presentComponents[j], data);
+            *output = index;
+            ++output;
+        }
+
+        chunkData = Data{};
+        chunk.presentComponents = std::vector<unsigned char>{};
+    });
+}
+
+} // namespace Detail
+
+bool parse(const char *text, size_t size, Data &data, std::string &warning,
+           std::string &error)
+{
+    PROGRAM_PROFILE_ZONE("Obj::parse");
+
+    auto chunks{Detail::splitChunks(text, size)};
+
+    Parallel::forEach(chunks.size(),
+                      [&chunks](size_t i) { Detail::parseChunk(chunks[i]); });
+
+    size_t skippedFaces{0};
+    for (const auto &chunk : chunks)
+    {
+        if (chunk.errorPosition)
+        {
+            error += StringFormat::StringFormat(
+                "Failed to parse line %zu.\n",
+                Detail::lineNumber(text, chunk.errorPosition));
+            return false;
+        }
+
+        skippedFaces += chunk.skippedFaces;
+    }
+
+    if (skippedFaces != 0)
+    {
+        warning += StringFormat::StringFormat(
+            "Ignored %zu face(s) with less than 3 vertices.\n", skippedFaces);
+    }
+
+    data = Data{};
+    {
+        PROGRAM_PROFILE_ZONE("Obj::merge");
+        Detail::merge(chunks, data);
+    }
+
+    for (const auto &chunk : chunks)
+    {
+        if (chunk.invalidIndex)
+        {
+            error += "Face index out of range.\n";
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool parseFile(const char *fileName, Data &data, std::string &warning,
+               std::string &error)
+{
+    FileIO::MappedFile file{fileName};
+    if (!file.isOpen())
+    {
+        error += StringFormat::StringFormat("Cannot open file [%s].\n",
+                                            fileName);
+        return false;
+    }
+
+    return parse(file.data(), file.size(), data, warning, error);
+}
+
+} // namespace Obj
+
+} // namespace Model
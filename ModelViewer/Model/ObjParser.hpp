@@ -0,0 +1,50 @@
+#ifndef MODELVIEWER_MODEL_OBJPARSER_HPP_
+#define MODELVIEWER_MODEL_OBJPARSER_HPP_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace Model
+{
+
+namespace Obj
+{
+
+struct Index
+{
+    int vertex;
+    int normal;
+    int textureCoordinate;
+};
+
+/*
+ * Parsed content of an obj file. Faces are triangulated, every 3 entries in
+ * indices form a triangle. Indices are zero based, a missing normal or texture
+ * coordinate is stored as -1.
+ */
+struct Data
+{
+    std::vector<float> vertices;
+    std::vector<float> normals;
+    std::vector<float> textureCoordinates;
+    std::vector<Index> indices;
+};
+
+/*
+ * The text is split into line-aligned chunks which are parsed on all cores.
+ * Relative (negative) indices are resolved when the chunks are merged.
+ *
+ * Only 'v', 'vn', 'vt' and 'f' records are read. Other records are ignored.
+ */
+bool parse(const char *text, size_t size, Data &data, std::string &warning,
+           std::string &error);
+
+bool parseFile(const char *fileName, Data &data, std::string &warning,
+               std::string &error);
+
+} // namespace Obj
+
+} // namespace Model
+
+#endif // MODELVIEWER_MODEL_OBJPARSER_HPP_
@@ -0,0 +1,190 @@
+#include "VertexMap.hpp"
+
+#include "Hash/Hash.hpp"
+#include "Profiler/Profiler.hpp"
+#include "Utils/Parallel/Parallel.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace Model
+{
+
+namespace Detail
+{
+
+template <typename VertexType, typename IndexType, typename VertexFunction>
+void deduplicateSerial(size_t cornerCount, VertexFunction &vertexAt,
+                       std::vector<VertexType> &vertices,
+                       std::vector<IndexType> &indices)
+{
+    PROGRAM_PROFILE_ZONE("VertexMap::insert");
+
+    VertexMap<VertexType, IndexType> map;
+    map.reserve(cornerCount);
+
+    for (size_t i{0}; i < cornerCount; ++i)
+    {
+        map.insert(vertexAt(i));
+    }
+
+    map.getVertices(vertices);
+    map.getIndices(indices);
+}
+
+template <typename VertexType, typename IndexType, typename VertexFunction>
+void deduplicateParallel(size_t cornerCount, VertexFunction &vertexAt,
+                         std::vector<VertexType> &vertices,
+                         std::vector<IndexType> &indices)
+{
+    const auto layout{shardLayout()};
+    const size_t shardBits{layout.shardBits};
+    const size_t shardCount{layout.shardCount};
+    const size_t chunkCount{layout.chunkCount};
+    const size_t chunkSize{(cornerCount + chunkCount - 1) / chunkCount};
+
+    auto chunkBegin{[=](size_t chunk) {
+        return std::min(chunk * chunkSize, cornerCount);
+    }};
+
+    // Pass 1: every chunk lists its corners per shard, in corner order.
+    std::vector<uint8_t> shardOf(cornerCount);
+    std::vector<std::vector<std::vector<size_t>>> chunkShards(
+        chunkCount, std::vector<std::vector<size_t>>(shardCount));
+
+    Parallel::forEach(chunkCount, [&](size_t chunk) {
+        PROGRAM_PROFILE_ZONE("Deduplicate::hash");
+
+        Hash::FastHash<VertexType> hash;
+        auto &shards{chunkShards[chunk]};
+
+        for (size_t i{chunkBegin(chunk)}; i < chunkBegin(chunk + 1); ++i)
+        {
+            const uint64_t value{hash(vertexAt(i))};
+            const auto folded{static_cast<uint32_t>(value ^ (value >> 32))};
+            const auto shard{static_cast<uint8_t>(
+                shardBits ? (folded >> (32 - shardBits)) : 0)};
+
+            shardOf[i] = shard;
+            shards[shard].push_back(i);
+        }
+    });
+
+    // Pass 2: deduplicate every shard on its own. Shard local ids follow the
+    // first occurrence order, the first corner of each id is flagged.
+    std::vector<IndexType> localOf(cornerCount);
+    std::vector<uint8_t> isFirst(cornerCount, 0);
+    std::vector<size_t> shardVertexCount(shardCount, 0);
+
+    Parallel::forEach(shardCount, [&](size_t shard) {
+        PROGRAM_PROFILE_ZONE("VertexMap::insert");
+
+        size_t shardCorners{0};
+        for (const auto &shards : chunkShards)
+        {
+            shardCorners += shards[shard].size();
+        }
+
+        VertexMap<VertexType, IndexType> map;
+        map.reserve(shardCorners);
+
+        for (const auto &shards : chunkShards)
+        {
+            for (const auto corner : shards[shard])
+            {
+                map.insert(vertexAt(corner));
+            }
+        }
+
+        std::vector<IndexType> localIndices;
+        map.getIndices(localIndices);
+
+        size_t next{0};
+        size_t k{0};
+        for (auto &shards : chunkShards)
+        {
+            for (const auto corner : shards[shard])
+            {
+                const auto local{localIndices[k++]};
+                localOf[corner] = local;
+                if (static_cast<size_t>(local) == next)
+                {
+                    isFirst[corner] = 1;
+                    ++next;
+                }
+            }
+
+            std::vector<size_t>{}.swap(shards[shard]);
+        }
+
+        shardVertexCount[shard] = next;
+    });
+
+    // Pass 3: global ids are the rank of the first corners in corner order.
+    std::vector<size_t> chunkVertexOffset(chunkCount + 1, 0);
+
+    Parallel::forEach(chunkCount, [&](size_t chunk) {
+        chunkVertexOffset[chunk + 1] = static_cast<size_t>(
+            std::count(isFirst.begin() + static_cast<ptrdiff_t>(
+                                             chunkBegin(chunk)),
+                       isFirst.begin() + static_cast<ptrdiff_t>(
+                                             chunkBegin(chunk + 1)),
+                       uint8_t{1}));
+    });
+
+    for (size_t chunk{0}; chunk < chunkCount; ++chunk)
+    {
+        chunkVertexOffset[chunk + 1] += chunkVertexOffset[chunk];
+    }
+
+    std::vector<std::vector<IndexType>> globalOf(shardCount);
+    for (size_t shard{0}; shard < shardCount; ++shard)
+    {
+        globalOf[shard].resize(shardVertexCount[shard]);
+    }
+
+    vertices.resize(chunkVertexOffset[chunkCount]);
+
+    Parallel::forEach(chunkCount, [&](size_t chunk) {
+        size_t global{chunkVertexOffset[chunk]};
+
+        for (size_t i{chunkBegin(chunk)}; i < chunkBegin(chunk + 1); ++i)
+        {
+            if (isFirst[i])
+            {
+                globalOf[shardOf[i]][static_cast<size_t>(localOf[i])] =
+                    static_cast<IndexType>(global);
+                vertices[global] = vertexAt(i);
+                ++global;
+            }
+        }
+    });
+
+    // Pass 4: remap every corner to its global id.
+    indices.resize(cornerCount);
+
+    Parallel::forEach(chunkCount, [&](size_t chunk) {
+        for (size_t i{chunkBegin(chunk)}; i < chunkBegin(chunk + 1); ++i)
+        {
+            indices[i] = globalOf[shardOf[i]][static_cast<size_t>(localOf[i])];
+        }
+    });
+}
+
+} // namespace Detail
+
+template <typename VertexType, typename IndexType, typename VertexFunction>
+void deduplicate(size_t cornerCount, VertexFunction &&vertexAt,
+                 std::vector<VertexType> &vertices,
+                 std::vector<IndexType> &indices)
+{
+    if (!Detail::isParallelDeduplication(cornerCount))
+    {
+        Detail::deduplicateSerial(cornerCount, vertexAt, vertices, indices);
+        return;
+    }
+
+    Detail::deduplicateParallel(cornerCount, vertexAt, vertices, indices);
+}
+
+} // namespace Model
@@ -0,0 +1,43 @@
+#include "VertexDeduplication.hpp"
+
+#include "Utils/Parallel/Parallel.hpp"
+
+namespace Model
+{
+
+namespace Detail
+{
+
+namespace Constant
+{
+
+constexpr size_t minimumParallelCorners{size_t{1} << 18};
+constexpr size_t shardsPerThread{4};
+constexpr size_t maximumShardBits{8};
+
+} // namespace Constant
+
+bool isParallelDeduplication(size_t cornerCount) noexcept
+{
+    return cornerCount >= Constant::minimumParallelCorners &&
+           Parallel::threadCount() > 1;
+}
+
+ShardLayout shardLayout() noexcept
+{
+    const size_t threads{Parallel::threadCount()};
+
+    size_t shardBits{0};
+    while ((size_t{1} << shardBits) < threads * Constant::shardsPerThread &&
+           shardBits < Constant::maximumShardBits)
+    {
+        ++shardBits;
+    }
+
+    return ShardLayout{shardBits, size_t{1} << shardBits,
+                       threads * Constant::shardsPerThread};
+}
+
+} // namespace Detail
+
+} // namespace Model
@@ -0,0 +1,43 @@
+#ifndef MODELVIEWER_MODEL_VERTEXDEDUPLICATION_HPP_
+#define MODELVIEWER_MODEL_VERTEXDEDUPLICATION_HPP_
+
+#include <cstddef>
+#include <vector>
+
+namespace Model
+{
+
+/*
+ * Deduplicate the vertices of cornerCount corners, vertexAt(i) returns the
+ * vertex of corner i. Vertices are numbered in order of first occurrence,
+ * exactly like inserting every corner into a VertexMap.
+ *
+ * Large inputs are partitioned by hash into shards which are deduplicated on
+ * all cores and then merged. Equal vertices must hash equally.
+ */
+template <typename VertexType, typename IndexType, typename VertexFunction>
+void deduplicate(size_t cornerCount, VertexFunction &&vertexAt,
+                 std::vector<VertexType> &vertices,
+                 std::vector<IndexType> &indices);
+
+namespace Detail
+{
+
+struct ShardLayout
+{
+    size_t shardBits;
+    size_t shardCount;
+    size_t chunkCount;
+};
+
+// The tuning lives in VertexDeduplication.cpp.
+bool isParallelDeduplication(size_t cornerCount) noexcept;
+ShardLayout shardLayout() noexcept;
+
+} // namespace Detail
+
+} // namespace Model
+
+#include "VertexDeduplication-inl.hpp"
+
+#endif // MODELVIEWER_MODEL_VERTEXDEDUPLICATION_HPP_
@@ -1,8 +1,22 @@
+#include <limits>
+
 namespace Model
 {
 
 template <typename VertexType, typename IndexType>
-VertexMap<VertexType, IndexType>::VertexMap() = default;
+constexpr size_t VertexMap<VertexType, IndexType>::minimumSlotCount;
+
+template <typename VertexType, typename IndexType>
+constexpr size_t VertexMap<VertexType, IndexType>::loadFactorNumerator;
+
+template <typename VertexType, typename IndexType>
+constexpr size_t VertexMap<VertexType, IndexType>::loadFactorDenominator;
+
+template <typename VertexType, typename IndexType>
+VertexMap<VertexType, IndexType>::VertexMap()
+    : indices{}, vertices{}, slots{}, mask{0}, growThreshold{0}, hash{}
+{
+}
 
 template <typename VertexType, typename IndexType>
 void VertexMap<VertexType, IndexType>::getIndices(std::vector<IndexType> &x)
@@ -17,20 +31,114 @@ void VertexMap<VertexType, IndexType>::getVertices(std::vector<VertexType> &x)
 }
 
 template <typename VertexType, typename IndexType>
-void VertexMap<VertexType, typename IndexType>::insert(const VertexType &vertex)
+void VertexMap<VertexType, IndexType>::reserve(size_t indexCount)
+{
+    reserve(indexCount, indexCount);
+}
+
+template <typename VertexType, typename IndexType>
+void VertexMap<VertexType, IndexType>::reserve(size_t indexCount,
+                                               size_t vertexCount)
 {
-    auto search{map.find(vertex)};
-    if (search != map.end())
+    indices.reserve(indexCount);
+    vertices.reserve(vertexCount);
+
+    const size_t capacity{capacityFor(vertexCount)};
+    if (capacity > slots.size())
+    {
+        rehash(capacity);
+    }
+}
+
+template <typename VertexType, typename IndexType>
+void VertexMap<VertexType, IndexType>::insert(const VertexType &vertex)
+{
+    if (vertices.size() >= growThreshold)
     {
-        indices.push_back(search->second);
-        return;
+        rehash(capacityFor((vertices.size() + 1) * 2));
     }
 
-    auto newIndex{static_cast<IndexType>(map.size())};
-    map[vertex] = newIndex;
+    const uint64_t value{hash(vertex)};
+    const uint32_t fingerprint{fingerprintOf(value)};
+
+    for (size_t i{static_cast<size_t>(value) & mask};; i = (i + 1) & mask)
+    {
+        auto &slot{slots[i]};
+
+        if (slot.index == emptyIndex())
+        {
+            const auto newIndex{static_cast<IndexType>(vertices.size())};
+            slot.fingerprint = fingerprint;
+            slot.index = newIndex;
+
+            vertices.push_back(vertex);
+            indices.push_back(newIndex);
+            return;
+        }
+
+        if (slot.fingerprint == fingerprint &&
+            vertices[static_cast<size_t>(slot.index)] == vertex)
+        {
+            indices.push_back(slot.index);
+            return;
+        }
+    }
+}
+
+template <typename VertexType, typename IndexType>
+constexpr IndexType VertexMap<VertexType, IndexType>::emptyIndex() noexcept
+{
+    return std::numeric_limits<IndexType>::max();
+}
+
+template <typename VertexType, typename IndexType>
+constexpr uint32_t
+VertexMap<VertexType, IndexType>::fingerprintOf(uint64_t hash) noexcept
+{
+    return static_cast<uint32_t>(hash ^ (hash >> 32));
+}
+
+template <typename VertexType, typename IndexType>
+size_t VertexMap<VertexType, IndexType>::capacityFor(size_t count) noexcept
+{
+    const size_t required{count * loadFactorDenominator / loadFactorNumerator +
+                          1};
+
+    size_t capacity{minimumSlotCount};
+    while (capacity < required)
+    {
+        capacity <<= 1;
+    }
+
+    return capacity;
+}
+
+template <typename VertexType, typename IndexType>
+void VertexMap<VertexType, IndexType>::rehash(size_t capacity)
+{
+    std::vector<Slot> newSlots(capacity, Slot{0, emptyIndex()});
+    const size_t newMask{capacity - 1};
+
+    for (const auto &slot : slots)
+    {
+        if (slot.index == emptyIndex())
+        {
+            continue;
+        }
+
+        const auto value{hash(vertices[static_cast<size_t>(slot.index)])};
+        size_t i{static_cast<size_t>(value) & newMask};
+        while (newSlots[i].index != emptyIndex())
+        {
+            i = (i + 1) & newMask;
+        }
+
+        newSlots[i] = slot;
+    }
 
-    vertices.push_back(vertex);
-    indices.push_back(newIndex);
+    slots.swap(newSlots);
+    mask = newMask;
+    growThreshold = capacity * loadFactorNumerator / loadFactorDenominator;
 }
 
 } // namespace Model
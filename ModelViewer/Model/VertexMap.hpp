@@ -3,13 +3,19 @@
 
 #include "Hash/Hash.hpp"
 
+#include <cstddef>
+#include <cstdint>
 #include <type_traits>
-#include <unordered_map>
 #include <vector>
 
 namespace Model
 {
 
+/*
+ * Deduplicates vertices with an open addressing table. Slots hold a hash
+ * fingerprint and the vertex index, probing is linear and the vertices are
+ * only compared when the fingerprints match.
+ */
 template <typename VertexType, typename IndexType = unsigned int>
 class VertexMap
 {
@@ -19,15 +25,45 @@ class VertexMap
 public:
     explicit VertexMap();
 
+    /*
+     * Size the table for indexCount inserts of at most vertexCount unique
+     * vertices, none of them rehashes or reallocates. Without vertexCount,
+     * every corner may be unique, like in flat shaded or unwelded meshes.
+     */
+    void reserve(size_t indexCount);
+    void reserve(size_t indexCount, size_t vertexCount);
+
     void insert(const VertexType &vertex);
 
     void getIndices(std::vector<IndexType> &x);
     void getVertices(std::vector<VertexType> &x);
 
 private:
+    struct Slot
+    {
+        uint32_t fingerprint;
+        IndexType index;
+    };
+
+    static constexpr size_t minimumSlotCount{16};
+
+    // Grow once the table is more than 3/4 full.
+    static constexpr size_t loadFactorNumerator{3};
+    static constexpr size_t loadFactorDenominator{4};
+
+    static constexpr IndexType emptyIndex() noexcept;
+    static constexpr uint32_t fingerprintOf(uint64_t hash) noexcept;
+    static size_t capacityFor(size_t count) noexcept;
+
+    void rehash(size_t capacity);
+
     std::vector<IndexType> indices;
     std::vector<VertexType> vertices;
-    std::unordered_map<VertexType, IndexType, Hash::FastHash<VertexType>> map;
+    std::vector<Slot> slots;
+    size_t mask;
+    // Vertex count which fills the table up to the load factor.
+    size_t growThreshold;
+    Hash::FastHash<VertexType> hash;
 };
 
 } // namespace Model
@@ -12,34 +12,30 @@ namespace Detail
 template <typename T>
 struct SetValue
 {
-    static void inline execute(unsigned int id, const char *name,
-                               T value) noexcept;
+    static void inline execute(int location, T value) noexcept;
 };
 
 template <typename T>
 struct SetVector2
 {
-    static void inline execute(unsigned int id, const char *name, T x,
-                               T y) noexcept;
-    static void inline execute(unsigned int id, const char *name,
+    static void inline execute(int location, T x, T y) noexcept;
+    static void inline execute(int location,
                                const glm::vec<2, T> &vector) noexcept;
 };
 
 template <typename T>
 struct SetVector3
 {
-    static void inline execute(unsigned int id, const char *name, T x, T y,
-                               T z) noexcept;
-    static void inline execute(unsigned int id, const char *name,
+    static void inline execute(int location, T x, T y, T z) noexcept;
+    static void inline execute(int location,
                                const glm::vec<3, T> &vector) noexcept;
 };
 
 template <typename T>
 struct SetVector4
 {
-    static void inline execute(unsigned int id, const char *name, T x, T y, T z,
-                               T w) noexcept;
-    static void inline execute(unsigned int id, const char *name,
+    static void inline execute(int location, T x, T y, T z, T w) noexcept;
+    static void inline execute(int location,
                                const glm::vec<4, T> &vector) noexcept;
 };
 
@@ -47,7 +43,7 @@ template <int row, int column>
 struct SetMatrix
 {
     static void inline execute(
-        unsigned int id, const char *name, bool transpose,
+        int location, bool transpose,
         const glm::mat<row, column, float> &matrix) noexcept;
 };
 
@@ -3,8 +3,10 @@
 
 #include "OpenGLBufferObject.hpp"
 #include "OpenGLException.hpp"
+#include "OpenGLFrameBufferObject.hpp"
 #include "OpenGLShader.hpp"
 #include "OpenGLShaderProgram.hpp"
+#include "OpenGLStateCache.hpp"
 #include "OpenGLTexture.hpp"
 #include "OpenGLVertexArrayObject.hpp"
 
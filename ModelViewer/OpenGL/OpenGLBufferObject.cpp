@@ -1,6 +1,7 @@
 #include "OpenGLBufferObject.hpp"
 
 #include "OpenGLException.hpp"
+#include "OpenGLStateCache.hpp"
 #include "Utils/PreDefine.hpp"
 
 namespace OpenGL
@@ -31,6 +32,8 @@ public:
     Impl &operator=(Impl &&other) noexcept = delete;
 
     void allocateBufferData(const void *data, GLsizeiptr size) noexcept;
+    void writeBufferData(GLintptr offset, const void *data,
+                         GLsizeiptr size) noexcept;
     void bind() noexcept;
     void release() noexcept;
 
@@ -71,6 +74,12 @@ void OpenGLBufferObject::allocateBufferData(const void *data,
     pimpl_->allocateBufferData(data, size);
 }
 
+void OpenGLBufferObject::writeBufferData(GLintptr offset, const void *data,
+                                         GLsizeiptr size) noexcept
+{
+    pimpl_->writeBufferData(offset, data, size);
+}
+
 void OpenGLBufferObject::bind() noexcept { pimpl_->bind(); }
 
 void OpenGLBufferObject::release() noexcept { pimpl_->release(); }
@@ -104,11 +113,20 @@ void OpenGLBufferObject::Impl::allocateBufferData(const void *data,
     glBufferData(type_, size, data, usagePattern_);
 }
 
+void OpenGLBufferObject::Impl::writeBufferData(GLintptr offset,
+                                               const void *data,
+                                               GLsizeiptr size) noexcept
+{
+    PROGRAM_ASSERT(isCreated());
+
+    glBufferSubData(type_, offset, size, data);
+}
+
 void OpenGLBufferObject::Impl::bind() noexcept
 {
     PROGRAM_ASSERT(isCreated());
 
-    glBindBuffer(type_, id_);
+    OpenGLStateCache::current().bindBuffer(type_, id_);
 }
 
 void OpenGLBufferObject::Impl::create()
@@ -132,7 +150,7 @@ void OpenGLBufferObject::Impl::release() noexcept
 {
     PROGRAM_ASSERT(isCreated());
 
-    glBindBuffer(type_, 0);
+    OpenGLStateCache::current().bindBuffer(type_, Detail::Constant::noId);
 }
 
 void OpenGLBufferObject::Impl::tidy()
@@ -140,6 +158,7 @@ void OpenGLBufferObject::Impl::tidy()
     PROGRAM_ASSERT(isCreated());
 
     glDeleteBuffers(1, &id_);
+    OpenGLStateCache::current().bufferDeleted(id_);
     id_ = Detail::Constant::noId;
 }
 
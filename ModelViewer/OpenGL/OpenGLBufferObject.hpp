@@ -30,7 +30,11 @@ public:
         /**
          * \brief Index buffer object
          */
-        ElementArrayBuffer = GL_ELEMENT_ARRAY_BUFFER
+        ElementArrayBuffer = GL_ELEMENT_ARRAY_BUFFER,
+        /**
+         * \brief Indirect draw command buffer object
+         */
+        DrawIndirectBuffer = GL_DRAW_INDIRECT_BUFFER
     };
 
     /**
@@ -135,6 +139,22 @@ public:
      */
     void allocateBufferData(const void *data, GLsizeiptr size) noexcept;
 
+    /**
+     * \brief Overwrite \p size bytes of the existing data storage, starting
+     * at \p offset bytes, with \p data.
+     *
+     * \par Note:
+     * The storage is not reallocated, so the range must lie inside the size
+     * given to allocateBufferData. Bind the OpenGLBufferObject before calling
+     * this function.
+     *
+     * \param offset Offset of the range in bytes.
+     * \param data A pointer to data which will copy into this buffer.
+     * \param size Size of the range in bytes.
+     */
+    void writeBufferData(GLintptr offset, const void *data,
+                         GLsizeiptr size) noexcept;
+
     /**
      * \brief Bind the OpenGLBufferObject to the current OpenGL content.
      *
@@ -0,0 +1,211 @@
+#include "OpenGLFrameBufferObject.hpp"
+
+#include "OpenGLException.hpp"
+
+#include "Utils/PreDefine.hpp"
+
+namespace OpenGL
+{
+
+namespace Detail
+{
+
+namespace Constant
+{
+
+constexpr GLuint noId{0};
+
+constexpr size_t channelCount{4};
+
+} // namespace Constant
+
+} // namespace Detail
+
+class OpenGLFrameBufferObject::Impl
+{
+public:
+    explicit Impl(const glm::ivec2 &size);
+    ~Impl();
+
+    Impl(Impl &&other) noexcept = delete;
+    Impl &operator=(Impl &&other) noexcept = delete;
+    Impl(const Impl &other) = delete;
+    Impl &operator=(const Impl &other) = delete;
+
+    void bind() noexcept;
+    void release() noexcept;
+
+    void resize(const glm::ivec2 &size);
+
+    void readPixels(std::vector<unsigned char> &pixels);
+
+    GLuint id() const noexcept;
+    glm::ivec2 size() const noexcept;
+
+private:
+    void allocate();
+    void create();
+    void tidy();
+
+    constexpr bool isCreated() const;
+
+    GLuint id_;
+    GLuint colorId_;
+    GLuint depthId_;
+    glm::ivec2 size_;
+};
+
+OpenGLFrameBufferObject::OpenGLFrameBufferObject(const glm::ivec2 &size)
+    : pimpl_{std::make_unique<Impl>(size)}
+{
+}
+
+OpenGLFrameBufferObject::OpenGLFrameBufferObject(
+    OpenGLFrameBufferObject &&other) noexcept = default;
+
+OpenGLFrameBufferObject &OpenGLFrameBufferObject::operator=(
+    OpenGLFrameBufferObject &&other) noexcept = default;
+
+OpenGLFrameBufferObject::~OpenGLFrameBufferObject() = default;
+
+void OpenGLFrameBufferObject::bind() noexcept { pimpl_->bind(); }
+
+GLuint OpenGLFrameBufferObject::id() const noexcept { return pimpl_->id(); }
+
+void OpenGLFrameBufferObject::readPixels(std::vector<unsigned char> &pixels)
+{
+    pimpl_->readPixels(pixels);
+}
+
+void OpenGLFrameBufferObject::release() noexcept { pimpl_->release(); }
+
+void OpenGLFrameBufferObject::resize(const glm::ivec2 &size)
+{
+    pimpl_->resize(size);
+}
+
+glm::ivec2 OpenGLFrameBufferObject::size() const noexcept
+{
+    return pimpl_->size();
+}
+
+OpenGLFrameBufferObject::Impl::Impl(const glm::ivec2 &size)
+    : id_{Detail::Constant::noId}, colorId_{Detail::Constant::noId},
+      depthId_{Detail::Constant::noId}, size_{size}
+{
+    create();
+}
+
+OpenGLFrameBufferObject::Impl::~Impl() { tidy(); }
+
+void OpenGLFrameBufferObject::Impl::allocate()
+{
+    glBindRenderbuffer(GL_RENDERBUFFER, colorId_);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, size_.x, size_.y);
+    glBindRenderbuffer(GL_RENDERBUFFER, depthId_);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, size_.x,
+                          size_.y);
+    glBindRenderbuffer(GL_RENDERBUFFER, Detail::Constant::noId);
+}
+
+void OpenGLFrameBufferObject::Impl::bind() noexcept
+{
+    PROGRAM_ASSERT(isCreated());
+
+    glBindFramebuffer(GL_FRAMEBUFFER, id_);
+}
+
+void OpenGLFrameBufferObject::Impl::create()
+{
+    PROGRAM_ASSERT(!isCreated());
+
+    glGenFramebuffers(1, &id_);
+    if (!isCreated())
+    {
+        throw OpenGLException("OpenGLFrameBufferObject instantiate failed at "
+                              "'glGenFramebuffers'.");
+    }
+
+    glGenRenderbuffers(1, &colorId_);
+    glGenRenderbuffers(1, &depthId_);
+    allocate();
+
+    glBindFramebuffer(GL_FRAMEBUFFER, id_);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0,
+                              GL_RENDERBUFFER, colorId_);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT,
+                              GL_RENDERBUFFER, depthId_);
+    auto status{glCheckFramebufferStatus(GL_FRAMEBUFFER)};
+    glBindFramebuffer(GL_FRAMEBUFFER, Detail::Constant::noId);
+
+    if (status != GL_FRAMEBUFFER_COMPLETE)
+    {
+        tidy();
+        throw OpenGLException("OpenGLFrameBufferObject instantiate failed at "
+                              "'glCheckFramebufferStatus'.");
+    }
+}
+
+GLuint OpenGLFrameBufferObject::Impl::id() const noexcept { return id_; }
+
+constexpr bool OpenGLFrameBufferObject::Impl::isCreated() const
+{
+    return id_;
+}
+
+void OpenGLFrameBufferObject::Impl::readPixels(
+    std::vector<unsigned char> &pixels)
+{
+    PROGRAM_ASSERT(isCreated());
+
+    pixels.resize(static_cast<size_t>(size_.x) * static_cast<size_t>(size_.y) *
+                  Detail::Constant::channelCount);
+
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, id_);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, size_.x, size_.y, GL_RGBA, GL_UNSIGNED_BYTE,
+                 pixels.data());
+}
+
+void OpenGLFrameBufferObject::Impl::release() noexcept
+{
+    PROGRAM_ASSERT(isCreated());
+
+    glBindFramebuffer(GL_FRAMEBUFFER, Detail::Constant::noId);
+}
+
+void OpenGLFrameBufferObject::Impl::resize(const glm::ivec2 &size)
+{
+    PROGRAM_ASSERT(isCreated());
+
+    if (size == size_)
+    {
+        return;
+    }
+
+    // Reallocating keeps the renderbuffer ids, the attachments stay valid.
+    size_ = size;
+    allocate();
+}
+
+glm::ivec2 OpenGLFrameBufferObject::Impl::size() const noexcept
+{
+    return size_;
+}
+
+void OpenGLFrameBufferObject::Impl::tidy()
+{
+    if (!isCreated())
+    {
+        return;
+    }
+
+    glDeleteRenderbuffers(1, &depthId_);
+    glDeleteRenderbuffers(1, &colorId_);
+    glDeleteFramebuffers(1, &id_);
+    depthId_ = Detail::Constant::noId;
+    colorId_ = Detail::Constant::noId;
+    id_ = Detail::Constant::noId;
+}
+
+} // namespace OpenGL
@@ -0,0 +1,114 @@
+#ifndef MODELVIEWER_OPENGL_OPENGLFRAMEBUFFEROBJECT_HPP_
+#define MODELVIEWER_OPENGL_OPENGLFRAMEBUFFEROBJECT_HPP_
+
+#include "OpenGLLib.hpp"
+
+#include "glm/vec2.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace OpenGL
+{
+
+/**
+ * \brief This class represents the OpenGL frame buffer object with a RGBA8
+ * color and a 24-bit depth renderbuffer attached.
+ *
+ * \par Warning:
+ * This class is not thread safe. Please use it under the same thread which
+ * creates OpenGL content.
+ */
+class OpenGLFrameBufferObject
+{
+public:
+    /**
+     * \brief Initializes a new instance of the OpenGLFrameBufferObject class
+     * with specified \p size.
+     *
+     * \param size Specified size in pixels.
+     *
+     * \exception OpenGLException Frame buffer failed to instantiate or is not
+     * complete.
+     */
+    explicit OpenGLFrameBufferObject(const glm::ivec2 &size);
+
+    /**
+     * \brief Initializes a new instance of the OpenGLFrameBufferObject class
+     * with the content of \p other.
+     *
+     * \param other Another object to assign with.
+     */
+    OpenGLFrameBufferObject(OpenGLFrameBufferObject &&other) noexcept;
+
+    /**
+     * \brief Initializes a new instance of the OpenGLFrameBufferObject class
+     * with the content of \p other.
+     *
+     * \param other Another object to assign with.
+     */
+    OpenGLFrameBufferObject &
+    operator=(OpenGLFrameBufferObject &&other) noexcept;
+
+    /**
+     * \brief Destroy the instance of the OpenGLFrameBufferObject class.
+     */
+    ~OpenGLFrameBufferObject();
+
+    OpenGLFrameBufferObject(const OpenGLFrameBufferObject &other) = delete;
+    OpenGLFrameBufferObject &
+    operator=(const OpenGLFrameBufferObject &other) = delete;
+
+    /**
+     * \brief Bind the OpenGLFrameBufferObject as the draw and read frame
+     * buffer of the current OpenGL content.
+     *
+     * \sa release
+     */
+    void bind() noexcept;
+
+    /**
+     * \brief Bind the default frame buffer back to the current OpenGL
+     * content.
+     *
+     * \sa bind
+     */
+    void release() noexcept;
+
+    /**
+     * \brief Reallocate the attachments with specified \p size. The content
+     * is undefined afterwards.
+     *
+     * \param size Specified size in pixels.
+     */
+    void resize(const glm::ivec2 &size);
+
+    /**
+     * \brief Read the color attachment back from OpenGL server.
+     *
+     * \param pixels Receives the RGBA8 pixels, row by row from the bottom.
+     */
+    void readPixels(std::vector<unsigned char> &pixels);
+
+    /**
+     * \brief Gets the id of the OpenGLFrameBufferObject
+     *
+     * \return The id value.
+     */
+    GLuint id() const noexcept;
+
+    /**
+     * \brief Gets the size of the attachments.
+     *
+     * \return Requested value.
+     */
+    glm::ivec2 size() const noexcept;
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> pimpl_;
+};
+
+} // namespace OpenGL
+
+#endif // MODELVIEWER_OPENGL_OPENGLFRAMEBUFFEROBJECT_HPP_
@@ -2,13 +2,11 @@
 
 #include "OpenGLException.hpp"
 
-#include "FileIO/FileIn.hpp"
+#include "FileIO/MappedFile.hpp"
 #include "Utils/PreDefine.hpp"
 
 #include <cstring>
 
-#include <string>
-
 namespace OpenGL
 {
 
@@ -47,6 +45,7 @@ private:
     void create();
     void tidy();
 
+    bool compile(const char *source, const GLint *length) noexcept;
     bool compileStatus() const;
 
     constexpr bool isCreated() const;
@@ -94,16 +93,29 @@ OpenGLShader::Impl::~Impl() { tidy(); }
 
 bool OpenGLShader::Impl::compileFromFile(const char *fileName) noexcept
 {
-    std::string source{FileIO::ReadFileFullText(fileName)};
+    FileIO::MappedFile file{fileName};
+
+    if (!file.isOpen())
+    {
+        return false;
+    }
 
-    return compileFromSource(source.c_str());
+    const GLint length{static_cast<GLint>(file.size())};
+
+    return compile(file.data(), &length);
 }
 
 bool OpenGLShader::Impl::compileFromSource(const char *source) noexcept
+{
+    return compile(source, NULL);
+}
+
+bool OpenGLShader::Impl::compile(const char *source,
+                                 const GLint *length) noexcept
 {
     PROGRAM_ASSERT(isCreated());
 
-    glShaderSource(id_, 1, &source, NULL);
+    glShaderSource(id_, 1, &source, length);
     glCompileShader(id_);
 
     return compileStatus();
@@ -1,11 +1,16 @@
 #include "OpenGLShaderProgram.hpp"
 
 #include "OpenGLException.hpp"
+#include "OpenGLStateCache.hpp"
 
+#include "Hash/Hash.hpp"
 #include "Utils/PreDefine.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <iostream>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace OpenGL
@@ -18,9 +23,30 @@ namespace Constant
 {
 
 constexpr GLuint noId{0};
+constexpr GLint noLocation{-1};
 
 } // namespace Constant
 
+struct Uniform
+{
+    size_t hash;
+    GLint location;
+    std::string name;
+};
+
+size_t uniformHash(const char *name, size_t length) noexcept;
+bool uniformOrder(const Uniform &x, const Uniform &y) noexcept;
+
+size_t uniformHash(const char *name, size_t length) noexcept
+{
+    return Hash::FastHash<char>{}(name, length);
+}
+
+bool uniformOrder(const Uniform &x, const Uniform &y) noexcept
+{
+    return x.hash < y.hash;
+}
+
 } // namespace Detail
 
 class OpenGLShaderProgram::Impl
@@ -48,14 +74,20 @@ public:
                              GLboolean normalized, GLsizei stride,
                              int offset) noexcept;
 
+    void setAttributeDivisor(GLuint index, GLuint divisor) noexcept;
+
     bool linkStatus() const noexcept;
 
     void use() noexcept;
 
+    UniformLocation uniformLocation(const char *name) const noexcept;
+
     GLuint id() const noexcept;
 
 private:
     void attachShader(std::unique_ptr<OpenGLShader> &&shader);
+    void collectUniforms();
+    void addUniform(std::string name, GLint location);
 
     void create();
     void tidy();
@@ -67,6 +99,9 @@ private:
     GLuint id_;
 
     std::vector<std::unique_ptr<OpenGLShader>> shaders_;
+
+    // Sorted by hash, small enough that a binary search beats a hash table.
+    std::vector<Detail::Uniform> uniforms_;
 };
 
 OpenGLShaderProgram::OpenGLShaderProgram() : pimpl_{std::make_unique<Impl>()} {}
@@ -118,9 +153,25 @@ void OpenGLShaderProgram::mapAttributePointer(GLuint index, GLint size,
     pimpl_->mapAttributePointer(index, size, type, normalized, stride, offset);
 }
 
+void OpenGLShaderProgram::setAttributeDivisor(GLuint index,
+                                              GLuint divisor) noexcept
+{
+    pimpl_->setAttributeDivisor(index, divisor);
+}
+
+UniformLocation
+OpenGLShaderProgram::uniformLocation(const char *name) const noexcept
+{
+    return pimpl_->uniformLocation(name);
+}
+
 void OpenGLShaderProgram::use() noexcept { pimpl_->use(); }
 
-OpenGLShaderProgram::Impl::Impl() : id_{Detail::Constant::noId} { create(); }
+OpenGLShaderProgram::Impl::Impl()
+    : id_{Detail::Constant::noId}, shaders_{}, uniforms_{}
+{
+    create();
+}
 
 OpenGLShaderProgram::Impl::~Impl() { tidy(); }
 
@@ -182,6 +233,12 @@ bool OpenGLShaderProgram::Impl::addShaderFromSource(OpenGLShader::Type type,
     return true;
 }
 
+void OpenGLShaderProgram::Impl::addUniform(std::string name, GLint location)
+{
+    const auto hash{Detail::uniformHash(name.data(), name.size())};
+    uniforms_.push_back(Detail::Uniform{hash, location, std::move(name)});
+}
+
 void OpenGLShaderProgram::Impl::attachShader(
     std::unique_ptr<OpenGLShader> &&shader)
 {
@@ -191,6 +248,45 @@ void OpenGLShaderProgram::Impl::attachShader(
     shaders_.push_back(std::move(shader));
 }
 
+void OpenGLShaderProgram::Impl::collectUniforms()
+{
+    uniforms_.clear();
+
+    GLint count;
+    GLint maxLength;
+    glGetProgramiv(id_, GL_ACTIVE_UNIFORMS, &count);
+    glGetProgramiv(id_, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+
+    std::vector<GLchar> buffer(static_cast<size_t>(std::max(maxLength, 1)));
+    for (GLint i{0}; i < count; ++i)
+    {
+        GLsizei length;
+        GLint size;
+        GLenum type;
+        glGetActiveUniform(id_, static_cast<GLuint>(i), maxLength, &length,
+                           &size, &type, buffer.data());
+
+        std::string name{buffer.data(), static_cast<size_t>(length)};
+        const GLint location{glGetUniformLocation(id_, name.c_str())};
+        if (location == Detail::Constant::noLocation)
+        {
+            // Uniforms in uniform blocks have no location.
+            continue;
+        }
+
+        // An uniform array is listed as "name[0]", also accept "name".
+        const auto suffix{name.rfind("[0]")};
+        if (suffix != std::string::npos && suffix + 3 == name.size())
+        {
+            addUniform(name.substr(0, suffix), location);
+        }
+
+        addUniform(std::move(name), location);
+    }
+
+    std::sort(uniforms_.begin(), uniforms_.end(), Detail::uniformOrder);
+}
+
 void OpenGLShaderProgram::Impl::create()
 {
     PROGRAM_ASSERT(!isCreated());
@@ -209,6 +305,7 @@ void OpenGLShaderProgram::Impl::destroyProgram()
     PROGRAM_ASSERT(isCreated());
 
     glDeleteProgram(id_);
+    OpenGLStateCache::current().programDeleted(id_);
     id_ = Detail::Constant::noId;
 }
 
@@ -238,7 +335,19 @@ GLuint OpenGLShaderProgram::Impl::id() const noexcept { return id_; }
 
 constexpr bool OpenGLShaderProgram::Impl::isCreated() const { return id_; }
 
-void OpenGLShaderProgram::Impl::link() noexcept { glLinkProgram(id_); }
+void OpenGLShaderProgram::Impl::link() noexcept
+{
+    glLinkProgram(id_);
+
+    if (linkStatus())
+    {
+        collectUniforms();
+    }
+    else
+    {
+        uniforms_.clear();
+    }
+}
 
 bool OpenGLShaderProgram::Impl::linkStatus() const noexcept
 {
@@ -258,6 +367,12 @@ void OpenGLShaderProgram::Impl::mapAttributePointer(GLuint index, GLint size,
                           PROGRAM_BUFFER_OFFSET(offset));
 }
 
+void OpenGLShaderProgram::Impl::setAttributeDivisor(GLuint index,
+                                                    GLuint divisor) noexcept
+{
+    glVertexAttribDivisor(index, divisor);
+}
+
 void OpenGLShaderProgram::Impl::tidy()
 {
     PROGRAM_ASSERT(isCreated());
@@ -266,6 +381,36 @@ void OpenGLShaderProgram::Impl::tidy()
     destroyProgram();
 }
 
-void OpenGLShaderProgram::Impl::use() noexcept { glUseProgram(id_); }
+UniformLocation
+OpenGLShaderProgram::Impl::uniformLocation(const char *name) const noexcept
+{
+    const auto length{std::strlen(name)};
+    const auto hash{Detail::uniformHash(name, length)};
+
+    auto it{std::lower_bound(
+        uniforms_.cbegin(), uniforms_.cend(), hash,
+        [](const Detail::Uniform &x, size_t y) { return x.hash < y; })};
+    for (; it != uniforms_.cend() && it->hash == hash; ++it)
+    {
+        if (it->name.size() == length &&
+            std::memcmp(it->name.data(), name, length) == 0)
+        {
+            return UniformLocation{it->location};
+        }
+    }
+
+    // Only elements of an uniform array after the first one are not listed.
+    if (!std::strchr(name, '['))
+    {
+        return UniformLocation{Detail::Constant::noLocation};
+    }
+
+    return UniformLocation{glGetUniformLocation(id_, name)};
+}
+
+void OpenGLShaderProgram::Impl::use() noexcept
+{
+    OpenGLStateCache::current().useProgram(id_);
+}
 
 } // namespace OpenGL
@@ -12,6 +12,20 @@
 namespace OpenGL
 {
 
+/**
+ * \brief This struct represents the location of an uniform in an
+ * OpenGLShaderProgram.
+ *
+ * \details Query it once with OpenGLShaderProgram::uniformLocation and pass
+ * it to OpenGLShaderProgram::setValue on every draw, which skips the lookup
+ * by name. A location of \c -1 does not refer to any uniform and setting it
+ * is silently ignored.
+ */
+struct UniformLocation
+{
+    GLint value;
+};
+
 /**
  * \brief This class represents the OpenGL shader program.
  *
@@ -54,7 +68,8 @@ public:
     ~OpenGLShaderProgram();
 
     /**
-     * \brief Link the shaders in the OpenGLShaderProgram together.
+     * \brief Link the shaders in the OpenGLShaderProgram together and collect
+     * the locations of its active uniforms.
      */
     void link() noexcept;
 
@@ -124,6 +139,16 @@ public:
                              GLboolean normalized, GLsizei stride,
                              int offset) noexcept;
 
+    /**
+     * \brief Set how often the vertex attribute at \p index advances while
+     * drawing instances.
+     *
+     * \param index The index location of the shader.
+     * \param divisor \c 0 to advance per vertex, otherwise the number of
+     * instances which share one attribute value.
+     */
+    void setAttributeDivisor(GLuint index, GLuint divisor) noexcept;
+
     /**
      * \brief Use the OpenGLShaderProgram to the current rendering state.
      */
@@ -139,6 +164,18 @@ public:
     template <typename T>
     void setValue(const char *name, T value) const noexcept;
 
+    /**
+     * \overload
+     *
+     * \brief Set the uniform value at \p location to \p value.
+     *
+     * \tparam T Must be \c bool, \c int, \c unsigned int, and \c float type.
+     * \param location The location of the specified value.
+     * \param value Specified value.
+     */
+    template <typename T>
+    void setValue(UniformLocation location, T value) const noexcept;
+
     /**
      * \overload
      *
@@ -153,6 +190,20 @@ public:
     template <typename T>
     void setValue(const char *name, T x, T y) const noexcept;
 
+    /**
+     * \overload
+     *
+     * \brief Set the uniform value at \p location to vector( \p x,
+     * \p y ).
+     *
+     * \tparam T T Must be \c int, \c unsigned int, and \c float type.
+     * \param location The location of the specified value.
+     * \param x Specified value of the x component.
+     * \param y Specified value of the y component.
+     */
+    template <typename T>
+    void setValue(UniformLocation location, T x, T y) const noexcept;
+
     /**
      * \overload
      *
@@ -165,6 +216,19 @@ public:
     template <typename T>
     void setValue(const char *name, glm::vec<2, T> vector) const noexcept;
 
+    /**
+     * \overload
+     *
+     * \brief Set the uniform value at \p location to \p vector.
+     *
+     * \tparam T T Must be \c int, \c unsigned int, and \c float type.
+     * \param location The location of the specified value.
+     * \param vector Specified value.
+     */
+    template <typename T>
+    void setValue(UniformLocation location,
+                  glm::vec<2, T> vector) const noexcept;
+
     /**
      * \overload
      *
@@ -180,6 +244,21 @@ public:
     template <typename T>
     void setValue(const char *name, T x, T y, T z) const noexcept;
 
+    /**
+     * \overload
+     *
+     * \brief Set the uniform value at \p location to vector( \p x,
+     * \p y \p z).
+     *
+     * \tparam T T Must be \c int, \c unsigned int, and \c float type.
+     * \param location The location of the specified value.
+     * \param x Specified value of the x component.
+     * \param y Specified value of the y component.
+     * \param z Specified value of the z component.
+     */
+    template <typename T>
+    void setValue(UniformLocation location, T x, T y, T z) const noexcept;
+
     /**
      * \overload
      *
@@ -192,6 +271,19 @@ public:
     template <typename T>
     void setValue(const char *name, glm::vec<3, T> vector) const noexcept;
 
+    /**
+     * \overload
+     *
+     * \brief Set the uniform value at \p location to \p vector.
+     *
+     * \tparam T T Must be \c int, \c unsigned int, and \c float type.
+     * \param location The location of the specified value.
+     * \param vector Specified value.
+     */
+    template <typename T>
+    void setValue(UniformLocation location,
+                  glm::vec<3, T> vector) const noexcept;
+
     /**
      * \overload
      *
@@ -207,6 +299,21 @@ public:
     template <typename T>
     void setValue(const char *name, T x, T y, T z, T w) const noexcept;
 
+    /**
+     * \overload
+     *
+     * \brief Set the uniform value at \p location to vector( \p x,
+     * \p y \p z).
+     *
+     * \tparam T T Must be \c int, \c unsigned int, and \c float type.
+     * \param location The location of the specified value.
+     * \param x Specified value of the x component.
+     * \param y Specified value of the y component.
+     * \param z Specified value of the z component.
+     */
+    template <typename T>
+    void setValue(UniformLocation location, T x, T y, T z, T w) const noexcept;
+
     /**
      * \overload
      *
@@ -219,6 +326,19 @@ public:
     template <typename T>
     void setValue(const char *name, glm::vec<4, T> vector) const noexcept;
 
+    /**
+     * \overload
+     *
+     * \brief Set the uniform value at \p location to \p vector.
+     *
+     * \tparam T T Must be \c int, \c unsigned int, and \c float type.
+     * \param location The location of the specified value.
+     * \param vector Specified value.
+     */
+    template <typename T>
+    void setValue(UniformLocation location,
+                  glm::vec<4, T> vector) const noexcept;
+
     /**
      * \overload
      *
@@ -235,6 +355,35 @@ public:
     void setValue(const char *name, glm::mat<row, column, float> matrix,
                   bool transpose) const noexcept;
 
+    /**
+     * \overload
+     *
+     * \brief Set the uniform value at \p location to \p matrix with or
+     * without \p transpose.
+     *
+     * @tparam row Must be 2, 3, 4.
+     * @tparam column Must be 2, 3, 4.
+     * @param location The location of the specified value.
+     * @param matrix Specified matrix.
+     * @param transpose The matrix should be transpose or not.
+     */
+    template <int row, int column>
+    void setValue(UniformLocation location, glm::mat<row, column, float> matrix,
+                  bool transpose) const noexcept;
+
+    /**
+     * \brief Gets the location of the uniform with the given \p name.
+     *
+     * \details The active uniforms are collected once after link, so the
+     * lookup does not query the driver. Only the elements of an uniform array
+     * other than the first one fall back to \c glGetUniformLocation.
+     *
+     * \param name The name of the uniform.
+     * \return Requested location. The value is \c -1 if there is no uniform
+     * called \p name.
+     */
+    UniformLocation uniformLocation(const char *name) const noexcept;
+
     /**
      * \brief Gets the link status of the OpenGLShader
      *
@@ -0,0 +1,183 @@
+#include "OpenGLStateCache.hpp"
+
+#include <limits>
+
+namespace OpenGL
+{
+
+namespace Detail
+{
+
+namespace Constant
+{
+
+constexpr GLuint unknown{std::numeric_limits<GLuint>::max()};
+
+} // namespace Constant
+
+} // namespace Detail
+
+constexpr size_t OpenGLStateCache::textureUnitCount;
+
+OpenGLStateCache::OpenGLStateCache() noexcept
+    : program_{Detail::Constant::unknown},
+      vertexArray_{Detail::Constant::unknown},
+      arrayBuffer_{Detail::Constant::unknown},
+      elementArrayBuffer_{Detail::Constant::unknown},
+      activeTexture_{Detail::Constant::unknown}, textures_{},
+      statistics_{0, 0}
+{
+    textures_.fill(Detail::Constant::unknown);
+}
+
+OpenGLStateCache &OpenGLStateCache::current() noexcept
+{
+    static thread_local OpenGLStateCache cache;
+
+    return cache;
+}
+
+void OpenGLStateCache::useProgram(GLuint id) noexcept
+{
+    if (update(program_, id))
+    {
+        glUseProgram(id);
+    }
+}
+
+void OpenGLStateCache::bindVertexArray(GLuint id) noexcept
+{
+    if (update(vertexArray_, id))
+    {
+        glBindVertexArray(id);
+
+        // The element array buffer binding belongs to the vertex array.
+        elementArrayBuffer_ = Detail::Constant::unknown;
+    }
+}
+
+void OpenGLStateCache::bindBuffer(GLenum target, GLuint id) noexcept
+{
+    switch (target)
+    {
+    case GL_ARRAY_BUFFER:
+        if (!update(arrayBuffer_, id))
+        {
+            return;
+        }
+        break;
+    case GL_ELEMENT_ARRAY_BUFFER:
+        if (!update(elementArrayBuffer_, id))
+        {
+            return;
+        }
+        break;
+    default:
+        ++statistics_.issued;
+        break;
+    }
+
+    glBindBuffer(target, id);
+}
+
+void OpenGLStateCache::activeTexture(GLenum unit) noexcept
+{
+    if (update(activeTexture_, unit - GL_TEXTURE0))
+    {
+        glActiveTexture(unit);
+    }
+}
+
+void OpenGLStateCache::bindTexture(GLenum target, GLuint id) noexcept
+{
+    if (target != GL_TEXTURE_2D || activeTexture_ >= textureUnitCount)
+    {
+        ++statistics_.issued;
+        glBindTexture(target, id);
+        return;
+    }
+
+    if (update(textures_[activeTexture_], id))
+    {
+        glBindTexture(target, id);
+    }
+}
+
+void OpenGLStateCache::programDeleted(GLuint id) noexcept
+{
+    // A program in use is only deleted once it is no longer in use.
+    if (program_ == id)
+    {
+        program_ = Detail::Constant::unknown;
+    }
+}
+
+void OpenGLStateCache::vertexArrayDeleted(GLuint id) noexcept
+{
+    if (vertexArray_ == id)
+    {
+        vertexArray_ = 0;
+        elementArrayBuffer_ = Detail::Constant::unknown;
+    }
+}
+
+void OpenGLStateCache::bufferDeleted(GLuint id) noexcept
+{
+    if (arrayBuffer_ == id)
+    {
+        arrayBuffer_ = 0;
+    }
+
+    if (elementArrayBuffer_ == id)
+    {
+        elementArrayBuffer_ = 0;
+    }
+}
+
+void OpenGLStateCache::textureDeleted(GLuint id) noexcept
+{
+    for (auto &texture : textures_)
+    {
+        if (texture == id)
+        {
+            texture = 0;
+        }
+    }
+}
+
+void OpenGLStateCache::invalidate() noexcept
+{
+    program_ = Detail::Constant::unknown;
+    vertexArray_ = Detail::Constant::unknown;
+    arrayBuffer_ = Detail::Constant::unknown;
+    elementArrayBuffer_ = Detail::Constant::unknown;
+    activeTexture_ = Detail::Constant::unknown;
+    textures_.fill(Detail::Constant::unknown);
+}
+
+const OpenGLStateCache::Statistics &
+OpenGLStateCache::statistics() const noexcept
+{
+    return statistics_;
+}
+
+void OpenGLStateCache::resetStatistics() noexcept
+{
+    statistics_ = Statistics{0, 0};
+}
+
+bool OpenGLStateCache::update(GLuint &binding, GLuint id) noexcept
+{
+    if (binding == id)
+    {
+        ++statistics_.skipped;
+        return false;
+    }
+
+    binding = id;
+    ++statistics_.issued;
+
+    return true;
+}
+
+} // namespace OpenGL
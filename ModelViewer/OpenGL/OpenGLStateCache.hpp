@@ -0,0 +1,101 @@
+#ifndef MODELVIEWER_OPENGL_OPENGLSTATECACHE_HPP_
+#define MODELVIEWER_OPENGL_OPENGLSTATECACHE_HPP_
+
+#include "OpenGLLib.hpp"
+
+#include <array>
+#include <cstddef>
+
+namespace OpenGL
+{
+
+/**
+ * \brief This class tracks the bindings of the current OpenGL context and
+ * skips the calls which would not change them.
+ *
+ * \details Every OpenGL wrapper class binds through the cache of the calling
+ * thread, which is the thread the context is current on. Only the program,
+ * the vertex array, the array and element array buffers and the 2D texture of
+ * each unit are tracked, other targets are always forwarded to OpenGL.
+ *
+ * \par Warning:
+ * Call invalidate after any code outside of the wrapper classes, e.g. ImGui,
+ * changed the bindings, or after making another context current.
+ */
+class OpenGLStateCache
+{
+public:
+    /**
+     * \brief This struct represents the number of calls since the last
+     * resetStatistics.
+     */
+    struct Statistics
+    {
+        /**
+         * \brief Calls forwarded to OpenGL.
+         */
+        size_t issued;
+
+        /**
+         * \brief Calls skipped because the binding did not change.
+         */
+        size_t skipped;
+    };
+
+    /**
+     * \brief Initializes a new instance of the OpenGLStateCache class with
+     * every binding unknown.
+     */
+    explicit OpenGLStateCache() noexcept;
+
+    /**
+     * \brief Gets the cache of the calling thread.
+     *
+     * \return Requested cache.
+     */
+    static OpenGLStateCache &current() noexcept;
+
+    void useProgram(GLuint id) noexcept;
+    void bindVertexArray(GLuint id) noexcept;
+    void bindBuffer(GLenum target, GLuint id) noexcept;
+    void activeTexture(GLenum unit) noexcept;
+    void bindTexture(GLenum target, GLuint id) noexcept;
+
+    /**
+     * \brief Forget the bindings of the deleted objects.
+     *
+     * \details OpenGL unbinds a deleted object, and may reuse its id for a new
+     * one. Call these right after the corresponding \c glDelete call.
+     */
+    void programDeleted(GLuint id) noexcept;
+    void vertexArrayDeleted(GLuint id) noexcept;
+    void bufferDeleted(GLuint id) noexcept;
+    void textureDeleted(GLuint id) noexcept;
+
+    /**
+     * \brief Mark every binding as unknown, so the next call of each kind is
+     * forwarded to OpenGL.
+     */
+    void invalidate() noexcept;
+
+    const Statistics &statistics() const noexcept;
+    void resetStatistics() noexcept;
+
+private:
+    static constexpr size_t textureUnitCount{16};
+
+    bool update(GLuint &binding, GLuint id) noexcept;
+
+    GLuint program_;
+    GLuint vertexArray_;
+    GLuint arrayBuffer_;
+    GLuint elementArrayBuffer_;
+    GLuint activeTexture_;
+    std::array<GLuint, textureUnitCount> textures_;
+
+    Statistics statistics_;
+};
+
+} // namespace OpenGL
+
+#endif // MODELVIEWER_OPENGL_OPENGLSTATECACHE_HPP_
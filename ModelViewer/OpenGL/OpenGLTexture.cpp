@@ -1,6 +1,7 @@
 #include "OpenGLTexture.hpp"
 
 #include "OpenGLException.hpp"
+#include "OpenGLStateCache.hpp"
 #include "Utils/PreDefine.hpp"
 
 PRAGMA_WARNING_PUSH
@@ -182,13 +183,13 @@ void OpenGLTexture::Impl::bind()
 {
     PROGRAM_ASSERT(isCreated());
 
-    glBindTexture(GL_TEXTURE_2D, id_);
+    OpenGLStateCache::current().bindTexture(GL_TEXTURE_2D, id_);
 }
 
 void OpenGLTexture::Impl::bindBuffer(
     const std::vector<unsigned char> &buffer) const
 {
-    glBindTexture(GL_TEXTURE_2D, id_);
+    OpenGLStateCache::current().bindTexture(GL_TEXTURE_2D, id_);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, minificationFilter_);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, magnificationFilter_);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, wrapOption_);
@@ -234,7 +235,8 @@ void OpenGLTexture::Impl::release()
 {
     PROGRAM_ASSERT(isCreated());
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    OpenGLStateCache::current().bindTexture(GL_TEXTURE_2D,
+                                            Detail::Constant::noId);
 }
 
 void OpenGLTexture::Impl::setMagnificationFilter(Filter filter)
@@ -273,6 +275,7 @@ void OpenGLTexture::Impl::tidy()
     PROGRAM_ASSERT(isCreated());
 
     glDeleteTextures(1, &id_);
+    OpenGLStateCache::current().textureDeleted(id_);
     id_ = Detail::Constant::noId;
 }
 
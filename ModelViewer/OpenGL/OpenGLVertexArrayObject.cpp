@@ -1,6 +1,7 @@
 #include "OpenGLVertexArrayObject.hpp"
 
 #include "OpenGLException.hpp"
+#include "OpenGLStateCache.hpp"
 
 #include "Utils/PreDefine.hpp"
 
@@ -74,7 +75,7 @@ void OpenGLVertexArrayObject::Impl::bind() noexcept
 {
     PROGRAM_ASSERT(isCreated());
 
-    glBindVertexArray(id_);
+    OpenGLStateCache::current().bindVertexArray(id_);
 }
 
 void OpenGLVertexArrayObject::Impl::create()
@@ -98,7 +99,7 @@ void OpenGLVertexArrayObject::Impl::release() noexcept
 {
     PROGRAM_ASSERT(isCreated());
 
-    glBindVertexArray(Detail::Constant::noId);
+    OpenGLStateCache::current().bindVertexArray(Detail::Constant::noId);
 }
 
 void OpenGLVertexArrayObject::Impl::tidy()
@@ -106,6 +107,7 @@ void OpenGLVertexArrayObject::Impl::tidy()
     PROGRAM_ASSERT(isCreated());
 
     glDeleteVertexArrays(1, &id_);
+    OpenGLStateCache::current().vertexArrayDeleted(id_);
     id_ = Detail::Constant::noId;
 }
 
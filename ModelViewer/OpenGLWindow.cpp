@@ -1,19 +1,31 @@
 #include "OpenGLWindow.hpp"
 
+#include "Event/ConcurrentEventQueue.hpp"
 #include "Event/Event.hpp"
+#include "Event/EventDispatcher.hpp"
 #include "Event/EventHandler.hpp"
+#include "Event/EventQueue.hpp"
 #include "Event/KeyboardEvent.hpp"
+#include "Event/LoadCompletedEvent.hpp"
 #include "Event/MouseEvent.hpp"
 #include "Event/MoveEvent.hpp"
 #include "Event/ResizeEvent.hpp"
 #include "Logger/Logger.hpp"
 #include "Model/ModelFactory.hpp"
 #include "OpenGL/OpenGLException.hpp"
+#include "OpenGL/OpenGLFrameBufferObject.hpp"
+#include "OpenGL/OpenGLStateCache.hpp"
 #include "OpenGLWindowBuilder.hpp"
+#include "Profiler/Profiler.hpp"
+#include "Render/FrustumCuller.hpp"
+#include "Render/GeometryPool.hpp"
+#include "Render/GpuProfiler.hpp"
+#include "Render/RenderQueue.hpp"
 #include "TimeFrame/TimeFrame.hpp"
 #include "Utils/PreDefine.hpp"
 #include "Utils/StringFormat/StringFormat.hpp"
 
+#include "glm/common.hpp"
 #include "glm/gtc/matrix_transform.hpp"
 #include "glm/gtc/type_ptr.hpp"
 #include "glm/mat4x4.hpp"
@@ -23,16 +35,35 @@
 #include "imgui/imgui_impl_glfw.h"
 #include "imgui/imgui_impl_opengl3.h"
 
-#include <forward_list>
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <chrono>
+#include <future>
 #include <iostream>
-#include <queue>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
 namespace Detail
 {
 
+namespace Constant
+{
+
+constexpr double millisecondsPerSecond{1000.0};
+
+constexpr int defaultStatisticsWindow{120};
+
+// ImGui needs a few frames after an input to settle, e.g. to show a hover.
+constexpr size_t redrawFrameCount{3};
+
+// Bounds an idle wait, in case a finished load did not wake it.
+constexpr double idleTimeout{0.5};
+
+} // namespace Constant
+
 bool compileShaders(OpenGL::OpenGLShaderProgram &program,
                     const char *vertexShaderFile,
                     const char *fragmentShaderFile = nullptr,
@@ -73,6 +104,57 @@ bool compileShaders(OpenGL::OpenGLShaderProgram &program,
     return true;
 }
 
+struct LoadedModel
+{
+    bool success;
+    Model::MeshData mesh;
+    bool hasTexture;
+    bool textureLoaded;
+    Model::ImageData image;
+    Model::MeshOptimizer::Report report;
+    std::string warning;
+    std::string error;
+};
+
+struct PooledModel
+{
+    Render::GeometryPool::Handle mesh;
+    OpenGL::OpenGLShaderProgram *program;
+    OpenGL::OpenGLTexture *texture;
+    Model::BoundingBox boundingBox;
+    Model::BoundingSphere boundingSphere;
+    glm::mat4 model;
+};
+
+struct PendingModel
+{
+    std::future<LoadedModel> loaded;
+    std::promise<bool> added;
+    OpenGL::OpenGLShaderProgram *program;
+    std::string source;
+};
+
+LoadedModel loadModel(const std::string &modelSource,
+                      const std::string &textureSource, bool hasTexture);
+
+LoadedModel loadModel(const std::string &modelSource,
+                      const std::string &textureSource, bool hasTexture)
+{
+    PROGRAM_PROFILE_ZONE("loadModel");
+
+    LoadedModel model;
+    model.hasTexture = hasTexture;
+    model.textureLoaded =
+        hasTexture &&
+        Model::ModelFactory::loadImageFromFile(textureSource.c_str(),
+                                               model.image);
+    model.success = Model::ModelFactory::loadMeshDataFromFile(
+        modelSource.c_str(), model.mesh, model.warning, model.error, true,
+        &(model.report));
+
+    return model;
+}
+
 } // namespace Detail
 
 class OpenGLWindow::Impl
@@ -93,9 +175,21 @@ public:
     Impl &operator=(const Impl &other) = delete;
 
     void startRender();
+    void startBenchmark(const Benchmark::CameraPath &path,
+                        Benchmark::BenchmarkReport &report);
 
     bool addModel(const char *modelSource, const char *textureSource,
                   OpenGL::OpenGLShaderProgram &program);
+    std::future<bool> addModelAsync(const char *modelSource,
+                                    const char *textureSource,
+                                    OpenGL::OpenGLShaderProgram &program);
+    Model::InstancedMesh *
+    addInstancedModel(const char *modelSource, const char *textureSource,
+                      OpenGL::OpenGLShaderProgram &program);
+    PooledModelHandle addPooledModel(const char *modelSource,
+                                     const char *textureSource,
+                                     OpenGL::OpenGLShaderProgram &program);
+    void setPooledModelMatrix(PooledModelHandle model, const glm::mat4 &matrix);
     OpenGL::OpenGLShaderProgram *
     addShader(const char *vertexShaderSource, const char *fragmentShaderSource,
               const char *geometryShaderSource = nullptr);
@@ -110,14 +204,23 @@ public:
 
     glm::ivec2 frameBufferSize() const;
 
+    bool isHeadless() const;
+    bool readFrameBuffer(std::vector<unsigned char> &pixels);
+
+    void setRenderOnDemand(bool onDemand);
+    bool isRenderOnDemand() const;
+    void requestRedraw();
+
     GLFWwindow &window();
     const GLFWwindow &window() const;
 
-    void pushEvent(std::unique_ptr<Event::Event> &&event);
+    void pushEvent(Event::Event &&event);
+    void subscribeEvent(std::unique_ptr<Event::EventHandlerBase> &&handler);
 
     void frameBufferResizeEvent(Event::FrameBufferResizeEvent *event);
     void mouseEvent(Event::MouseEvent *event);
     void keyboardEvent(Event::KeyboardEvent *event);
+    void loadCompletedEvent(Event::LoadCompletedEvent *event);
     void windowMoveEvent(Event::MoveEvent *event);
     void windowResizeEvent(Event::WindowResizeEvent *event);
 
@@ -138,6 +241,7 @@ private:
     void initializeEventQueue(OpenGLWindow &window);
     bool initializeGLAD();
     void initializeImgui();
+    void initializeOffscreen();
     bool initializeOpenGL(const glm::ivec2 &version);
 
     void destroy();
@@ -147,11 +251,17 @@ private:
     void destroyOpenGL();
 
     void windowFrameLoop();
+    void windowFrameBenchmarkUpdate();
     void windowFrameEventUpdate();
+    void windowFrameIdle();
+    void windowFrameModelUpdate();
     void windowFrameRender();
     void windowFrameRenderImguiUpdate();
 
+    void windowImguiDebugMessages();
+    void windowImguiFrameStatistics();
     void windowImguiGeneralSetting();
+    void windowImguiGpuProfiler();
 
     void handleEvent(Event::Event *event);
 
@@ -168,23 +278,66 @@ private:
     int frameBufferWidth() const;
 
     bool isRenderable() const;
+    bool isIdle() const;
+
+    bool uploadModel(Detail::LoadedModel &model,
+                     OpenGL::OpenGLShaderProgram &program);
+    OpenGL::OpenGLTexture *uploadTexture(Detail::LoadedModel &model);
+    static bool reportModel(const Detail::LoadedModel &model);
 
     GLFWwindow *window_;
-    std::queue<std::unique_ptr<Event::Event>> eventQueue_;
-    std::forward_list<std::unique_ptr<Event::EventHandlerBase>> eventHandlers_;
+    // Filled from any thread, moved to eventQueue_ every frame.
+    Event::ConcurrentEventQueue incomingEvents_;
+    // Coalesces the events of a frame before they are dispatched.
+    Event::EventQueue eventQueue_;
+    std::thread::id mainThread_;
+    Event::EventDispatcher eventDispatcher_;
 
     glm::ivec2 position_;
     glm::ivec2 windowSize_;
     glm::ivec2 frameBufferSize_;
     std::string title_;
 
+    bool headless_;
+    // Render target of a headless window, created with the OpenGL context.
+    std::unique_ptr<OpenGL::OpenGLFrameBufferObject> offscreen_;
+
     std::vector<std::unique_ptr<Model::Mesh>> models_;
+    std::vector<std::unique_ptr<Model::InstancedMesh>> instancedModels_;
+    std::vector<Detail::PooledModel> pooledModels_;
     std::vector<std::unique_ptr<OpenGL::OpenGLTexture>> textures;
     std::vector<std::unique_ptr<OpenGL::OpenGLShaderProgram>> shaders_;
+    std::vector<Detail::PendingModel> pendingModels_;
 
     RenderMode renderMode_;
 
+    Render::FrustumCuller culler_;
+    Render::RenderQueue renderQueue_;
+    // Created with the first pooled model, it needs the OpenGL context.
+    std::unique_ptr<Render::GeometryPool> geometryPool_;
+
+    // Created with the OpenGL context.
+    std::unique_ptr<Render::GpuProfiler> gpuProfiler_;
+    bool gpuDrawScopes_;
+    bool gpuResolved_;
+
     std::unique_ptr<TimeFrame::TimeFrame> timeFrame_;
+    int statisticsWindow_;
+    std::vector<float> frameDurations_;
+    std::vector<float> frameHistogram_;
+    // Index of the lowest severity logged in the debug messages panel.
+    int debugSeverity_;
+
+    // Set only while startBenchmark runs.
+    const Benchmark::CameraPath *benchmarkPath_;
+    Benchmark::BenchmarkReport *benchmarkReport_;
+    size_t benchmarkFrame_;
+    size_t drawCallCount_;
+
+    bool renderOnDemand_;
+    // Frames left to render before the window may wait idle. Only the main
+    // thread counts it down, requestRedraw may come from any thread.
+    std::atomic<size_t> redrawFrames_;
 
     glm::vec4 backgroundColor_;
 
@@ -192,6 +345,8 @@ private:
     glm::vec3 cameraPosition_;
 };
 
+constexpr OpenGLWindow::PooledModelHandle OpenGLWindow::invalidPooledModel;
+
 OpenGLWindow::OpenGLWindow(const OpenGLWindowBuilder &builder)
     : pimpl_{std::make_unique<Impl>(builder)}
 {
@@ -206,6 +361,34 @@ bool OpenGLWindow::addModel(const char *modelSource, const char *textureSource,
     return pimpl_->addModel(modelSource, textureSource, program);
 }
 
+std::future<bool>
+OpenGLWindow::addModelAsync(const char *modelSource, const char *textureSource,
+                            OpenGL::OpenGLShaderProgram &program)
+{
+    return pimpl_->addModelAsync(modelSource, textureSource, program);
+}
+
+Model::InstancedMesh *
+OpenGLWindow::addInstancedModel(const char *modelSource,
+                                const char *textureSource,
+                                OpenGL::OpenGLShaderProgram &program)
+{
+    return pimpl_->addInstancedModel(modelSource, textureSource, program);
+}
+
+OpenGLWindow::PooledModelHandle
+OpenGLWindow::addPooledModel(const char *modelSource, const char *textureSource,
+                             OpenGL::OpenGLShaderProgram &program)
+{
+    return pimpl_->addPooledModel(modelSource, textureSource, program);
+}
+
+void OpenGLWindow::setPooledModelMatrix(PooledModelHandle model,
+                                        const glm::mat4 &matrix)
+{
+    pimpl_->setPooledModelMatrix(model, matrix);
+}
+
 OpenGL::OpenGLShaderProgram *
 OpenGLWindow::addShader(const char *vertexShaderSource,
                         const char *fragmentShaderSource,
@@ -225,21 +408,45 @@ glm::ivec2 OpenGLWindow::frameBufferSize() const
     return pimpl_->frameBufferSize();
 }
 
+bool OpenGLWindow::isHeadless() const { return pimpl_->isHeadless(); }
+
+bool OpenGLWindow::isRenderOnDemand() const
+{
+    return pimpl_->isRenderOnDemand();
+}
+
 void OpenGLWindow::keyboardEvent(Event::KeyboardEvent *event)
 {
     pimpl_->keyboardEvent(event);
 }
 
+void OpenGLWindow::loadCompletedEvent(Event::LoadCompletedEvent *event)
+{
+    pimpl_->loadCompletedEvent(event);
+}
+
 void OpenGLWindow::mouseEvent(Event::MouseEvent *event)
 {
     pimpl_->mouseEvent(event);
 }
 
-void OpenGLWindow::pushEvent(std::unique_ptr<Event::Event> &&event)
+void OpenGLWindow::pushEvent(Event::Event &&event)
 {
     pimpl_->pushEvent(std::move(event));
 }
 
+bool OpenGLWindow::readFrameBuffer(std::vector<unsigned char> &pixels)
+{
+    return pimpl_->readFrameBuffer(pixels);
+}
+
+void OpenGLWindow::requestRedraw() { pimpl_->requestRedraw(); }
+
+void OpenGLWindow::setRenderOnDemand(bool onDemand)
+{
+    pimpl_->setRenderOnDemand(onDemand);
+}
+
 void OpenGLWindow::setWindowPosition(int x, int y)
 {
     pimpl_->setWindowPosition(x, y);
@@ -260,8 +467,20 @@ void OpenGLWindow::setWindowSize(int width, int height)
     pimpl_->setWindowSize(width, height);
 }
 
+void OpenGLWindow::startBenchmark(const Benchmark::CameraPath &path,
+                                  Benchmark::BenchmarkReport &report)
+{
+    pimpl_->startBenchmark(path, report);
+}
+
 void OpenGLWindow::startRender() { pimpl_->startRender(); }
 
+void OpenGLWindow::subscribeEvent(
+    std::unique_ptr<Event::EventHandlerBase> &&handler)
+{
+    pimpl_->subscribeEvent(std::move(handler));
+}
+
 glm::ivec2 OpenGLWindow::windowPosition() const
 {
     return pimpl_->windowPosition();
@@ -284,11 +503,20 @@ void OpenGLWindow::windowResizeEvent(Event::WindowResizeEvent *event)
 glm::ivec2 OpenGLWindow::windowSize() const { return pimpl_->windowSize(); }
 
 OpenGLWindow::Impl::Impl(const OpenGLWindowBuilder &builder)
-    : window_{nullptr}, eventQueue_{}, eventHandlers_{},
+    : window_{nullptr}, incomingEvents_{}, eventQueue_{},
+      mainThread_{std::this_thread::get_id()}, eventDispatcher_{},
       position_{builder.productPosition()}, windowSize_{builder.productSize()},
       frameBufferSize_{/* Not set until window is created */},
-      title_{builder.productTitle()}, renderMode_{RenderMode::Fill},
+      title_{builder.productTitle()}, headless_{builder.productHeadless()},
+      offscreen_{nullptr}, renderMode_{RenderMode::Fill}, culler_{},
+      renderQueue_{}, geometryPool_{nullptr}, gpuProfiler_{nullptr},
+      gpuDrawScopes_{false}, gpuResolved_{false},
       timeFrame_{/* Not set until window is created */},
+      statisticsWindow_{Detail::Constant::defaultStatisticsWindow},
+      frameDurations_{}, frameHistogram_{}, debugSeverity_{0},
+      benchmarkPath_{nullptr}, benchmarkReport_{nullptr}, benchmarkFrame_{0},
+      drawCallCount_{0}, renderOnDemand_{false},
+      redrawFrames_{Detail::Constant::redrawFrameCount},
       backgroundColor_{0.2f, 0.3f, 0.3f, 1.0f}, lookAt_{0},
       cameraPosition_{lookAt_ + glm::vec3{8}}
 {
@@ -300,39 +528,91 @@ bool OpenGLWindow::Impl::addModel(const char *modelSource,
                                   const char *textureSource,
                                   OpenGL::OpenGLShaderProgram &program)
 {
-    OpenGL::OpenGLTexture *texture_ptr{nullptr};
+    auto model{Detail::loadModel(modelSource,
+                                 textureSource ? textureSource : "",
+                                 textureSource)};
 
-    if (textureSource)
-    {
-        auto texture = Model::ModelFactory::loadTextureFromFile(textureSource);
-        texture_ptr = texture.get();
+    return uploadModel(model, program);
+}
 
-        textures.push_back(std::move(texture));
-    }
+std::future<bool>
+OpenGLWindow::Impl::addModelAsync(const char *modelSource,
+                                  const char *textureSource,
+                                  OpenGL::OpenGLShaderProgram &program)
+{
+    Detail::PendingModel pending;
+    pending.loaded = std::async(
+        std::launch::async,
+        [this](const std::string &model, const std::string &texture,
+               bool hasTexture) {
+            auto loaded{Detail::loadModel(model, texture, hasTexture)};
+
+            // Also wakes the frame loop, it may wait idle for this model.
+            pushEvent(Event::LoadCompletedEvent{model, loaded.success,
+                                                glfwGetTimerValue(), window_});
+
+            return loaded;
+        },
+        std::string{modelSource},
+        std::string{textureSource ? textureSource : ""},
+        textureSource != nullptr);
+    pending.program = &program;
+    pending.source = modelSource;
+
+    auto added{pending.added.get_future()};
+    pendingModels_.push_back(std::move(pending));
+
+    return added;
+}
 
-    std::string warning;
-    std::string error;
-    auto mesh = Model::ModelFactory::loadMeshFromFile(
-        modelSource, warning, error, program, texture_ptr);
+Model::InstancedMesh *
+OpenGLWindow::Impl::addInstancedModel(const char *modelSource,
+                                      const char *textureSource,
+                                      OpenGL::OpenGLShaderProgram &program)
+{
+    auto model{Detail::loadModel(modelSource,
+                                 textureSource ? textureSource : "",
+                                 textureSource)};
 
-    if (!warning.empty())
+    auto texture{uploadTexture(model)};
+    if (!reportModel(model))
     {
-        std::cerr << "[Warning]\n" << warning;
+        return nullptr;
     }
 
-    if (!error.empty())
+    instancedModels_.push_back(
+        std::make_unique<Model::InstancedMesh>(model.mesh, program, texture));
+
+    return instancedModels_.back().get();
+}
+
+OpenGLWindow::PooledModelHandle
+OpenGLWindow::Impl::addPooledModel(const char *modelSource,
+                                   const char *textureSource,
+                                   OpenGL::OpenGLShaderProgram &program)
+{
+    auto model{Detail::loadModel(modelSource,
+                                 textureSource ? textureSource : "",
+                                 textureSource)};
+
+    auto texture{uploadTexture(model)};
+    if (!reportModel(model))
     {
-        std::cerr << "[Error]\n" << error;
+        return invalidPooledModel;
     }
 
-    if (!mesh)
+    if (!geometryPool_)
     {
-        return false;
+        geometryPool_ = std::make_unique<Render::GeometryPool>();
     }
 
-    models_.push_back(std::move(mesh));
+    pooledModels_.push_back(Detail::PooledModel{
+        geometryPool_->add(model.mesh), &program, texture,
+        model.mesh.boundingBox(), model.mesh.boundingSphere(),
+        glm::mat4{1.0f}});
+    requestRedraw();
 
-    return true;
+    return pooledModels_.size() - 1;
 }
 
 OpenGL::OpenGLShaderProgram *
@@ -374,6 +654,8 @@ void OpenGLWindow::Impl::create(const glm::ivec2 &version, OpenGLWindow &window)
 
     initializeImgui();
 
+    gpuProfiler_ = std::make_unique<Render::GpuProfiler>();
+
     glEnable(GL_DEPTH_TEST);
 
     initializeEventQueue(window);
@@ -383,6 +665,11 @@ void OpenGLWindow::Impl::create(const glm::ivec2 &version, OpenGLWindow &window)
     glm::ivec2 frame;
     glfwGetFramebufferSize(window_, &(frame.x), &(frame.y));
     updateFrameBufferSize(frame);
+
+    if (headless_)
+    {
+        initializeOffscreen();
+    }
 }
 
 void OpenGLWindow::Impl::clearColor()
@@ -415,11 +702,20 @@ bool OpenGLWindow::Impl::createWindow(OpenGLWindow &window)
 
 void OpenGLWindow::Impl::destroy()
 {
+    for (auto &pending : pendingModels_)
+    {
+        pending.added.set_value(false);
+    }
+    pendingModels_.clear();
+
     for (auto &model : models_)
     {
         model.reset(nullptr);
     }
     models_.clear();
+    instancedModels_.clear();
+    pooledModels_.clear();
+    geometryPool_.reset(nullptr);
 
     for (auto &texture : textures)
     {
@@ -429,6 +725,9 @@ void OpenGLWindow::Impl::destroy()
 
     shaders_.clear();
 
+    offscreen_.reset(nullptr);
+    gpuProfiler_.reset(nullptr);
+
     destroyImgui();
     destroyDebug();
     destroyOpenGL();
@@ -446,6 +745,7 @@ void OpenGLWindow::Impl::destroyDebug()
         {
             glDisable(GL_DEBUG_OUTPUT);
             glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+            Logger::stop();
         }
     }
 #endif
@@ -480,9 +780,7 @@ int OpenGLWindow::Impl::frameBufferHeight() const { return frameBufferSize_.y; }
 void OpenGLWindow::Impl::frameBufferResizeEvent(
     Event::FrameBufferResizeEvent *event)
 {
-    auto size{event->size()};
-    frameBufferSize_ = size;
-    glViewport(0, 0, size.x, size.y);
+    updateFrameBufferSize(event->size());
 }
 
 void OpenGLWindow::Impl::frameBufferSizeCallback(GLFWwindow *window, int width,
@@ -496,8 +794,8 @@ void OpenGLWindow::Impl::frameBufferSizeCallback(GLFWwindow *window, int width,
         auto before{who->frameBufferSize()};
         auto after{glm::ivec2{width, height}};
 
-        who->pushEvent(std::make_unique<Event::FrameBufferResizeEvent>(
-            after, before, time, window));
+        who->pushEvent(
+            Event::FrameBufferResizeEvent{after, before, time, window});
     }
 }
 
@@ -505,13 +803,9 @@ int OpenGLWindow::Impl::frameBufferWidth() const { return frameBufferSize_.x; }
 
 void OpenGLWindow::Impl::handleEvent(Event::Event *event)
 {
-    for (auto &handler : eventHandlers_)
-    {
-        if (handler->handle(event))
-        {
-            return;
-        }
-    }
+    PROGRAM_PROFILE_ZONE("handleEvent");
+
+    eventDispatcher_.dispatch(event);
 }
 
 void OpenGLWindow::Impl::initializeDebug()
@@ -526,6 +820,7 @@ void OpenGLWindow::Impl::initializeDebug()
         {
             glEnable(GL_DEBUG_OUTPUT);
             glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+            Logger::start();
             glDebugMessageCallback(Logger::openGLDebugOutput, nullptr);
             glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE, 0,
                                   nullptr, GL_TRUE);
@@ -536,27 +831,31 @@ void OpenGLWindow::Impl::initializeDebug()
 
 void OpenGLWindow::Impl::initializeEventQueue(OpenGLWindow &window)
 {
-    eventHandlers_.push_front(
+    eventDispatcher_.subscribe(
         std::make_unique<Event::EventHandler<OpenGLWindow, Event::MoveEvent,
                                              &OpenGLWindow::windowMoveEvent>>(
             window));
-    eventHandlers_.push_front(
+    eventDispatcher_.subscribe(
         std::make_unique<
             Event::EventHandler<OpenGLWindow, Event::WindowResizeEvent,
                                 &OpenGLWindow::windowResizeEvent>>(window));
-    eventHandlers_.push_front(
+    eventDispatcher_.subscribe(
         std::make_unique<
             Event::EventHandler<OpenGLWindow, Event::FrameBufferResizeEvent,
                                 &OpenGLWindow::frameBufferResizeEvent>>(
             window));
-    eventHandlers_.push_front(
+    eventDispatcher_.subscribe(
         std::make_unique<Event::EventHandler<OpenGLWindow, Event::KeyboardEvent,
                                              &OpenGLWindow::keyboardEvent>>(
             window));
-    eventHandlers_.push_front(
+    eventDispatcher_.subscribe(
         std::make_unique<Event::EventHandler<OpenGLWindow, Event::MouseEvent,
                                              &OpenGLWindow::mouseEvent>>(
             window));
+    eventDispatcher_.subscribe(
+        std::make_unique<
+            Event::EventHandler<OpenGLWindow, Event::LoadCompletedEvent,
+                                &OpenGLWindow::loadCompletedEvent>>(window));
 }
 
 bool OpenGLWindow::Impl::initializeGLAD()
@@ -581,8 +880,26 @@ void OpenGLWindow::Impl::initializeImgui()
                                .c_str());
 }
 
+void OpenGLWindow::Impl::initializeOffscreen()
+{
+    offscreen_ = std::make_unique<OpenGL::OpenGLFrameBufferObject>(
+        glm::max(frameBufferSize_, glm::ivec2{1}));
+
+    // Nothing else binds a frame buffer, so it stays bound for the lifetime
+    // of the window and the frame loop runs unchanged.
+    offscreen_->bind();
+}
+
 bool OpenGLWindow::Impl::initializeOpenGL(const glm::ivec2 &version)
 {
+#ifdef GLFW_PLATFORM_NULL
+    if (headless_)
+    {
+        // No display server needed, the context comes from OSMesa.
+        glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+    }
+#endif
+
     if (!glfwInit())
     {
         return false;
@@ -599,9 +916,39 @@ bool OpenGLWindow::Impl::initializeOpenGL(const glm::ivec2 &version)
     glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
 #endif
 
+    if (headless_)
+    {
+        glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+#ifdef GLFW_PLATFORM_NULL
+        glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);
+#endif
+    }
+
     return true;
 }
 
+bool OpenGLWindow::Impl::isHeadless() const { return headless_; }
+
+bool OpenGLWindow::Impl::isIdle() const
+{
+    // The benchmark measures every frame, a headless window has no events.
+    if (!renderOnDemand_ || headless_ || benchmarkPath_ ||
+        redrawFrames_.load(std::memory_order_relaxed) ||
+        !eventQueue_.empty() || !incomingEvents_.empty())
+    {
+        return false;
+    }
+
+    return std::none_of(pendingModels_.begin(), pendingModels_.end(),
+                        [](const Detail::PendingModel &pending) {
+                            return pending.loaded.wait_for(
+                                       std::chrono::seconds{0}) ==
+                                   std::future_status::ready;
+                        });
+}
+
+bool OpenGLWindow::Impl::isRenderOnDemand() const { return renderOnDemand_; }
+
 bool OpenGLWindow::Impl::isRenderable() const
 {
     return (frameBufferSize_.x > 0 &&
@@ -627,8 +974,17 @@ void OpenGLWindow::Impl::keyboardInputCallback(GLFWwindow *window, int key,
     if (auto who{
             reinterpret_cast<OpenGLWindow *>(glfwGetWindowUserPointer(window))})
     {
-        who->pushEvent(std::make_unique<Event::KeyboardEvent>(
-            key, action, scancode, time, window, mods));
+        who->pushEvent(
+            Event::KeyboardEvent{key, action, scancode, time, window, mods});
+    }
+}
+
+void OpenGLWindow::Impl::loadCompletedEvent(Event::LoadCompletedEvent *event)
+{
+    // Reported as soon as the loader is done, not when the window closes.
+    if (!event->success())
+    {
+        std::cerr << "[Error]\nFailed to load " << event->source() << "\n";
     }
 }
 
@@ -648,14 +1004,63 @@ void OpenGLWindow::Impl::mouseButtonInputCallback(GLFWwindow *window,
     if (auto who{
             reinterpret_cast<OpenGLWindow *>(glfwGetWindowUserPointer(window))})
     {
-        who->pushEvent(std::make_unique<Event::MouseEvent>(
-            button, position, action, time, window, mods));
+        who->pushEvent(
+            Event::MouseEvent{button, position, action, time, window, mods});
+    }
+}
+
+void OpenGLWindow::Impl::pushEvent(Event::Event &&event)
+{
+    incomingEvents_.push(std::move(event));
+
+    // The GLFW callbacks run on the main thread, which is not waiting.
+    if (std::this_thread::get_id() != mainThread_)
+    {
+        glfwPostEmptyEvent();
     }
 }
 
-void OpenGLWindow::Impl::pushEvent(std::unique_ptr<Event::Event> &&event)
+void OpenGLWindow::Impl::requestRedraw()
 {
-    eventQueue_.push(std::move(event));
+    redrawFrames_.store(Detail::Constant::redrawFrameCount,
+                        std::memory_order_relaxed);
+
+    // Like pushEvent, wake the main thread if it waits idle.
+    if (std::this_thread::get_id() != mainThread_)
+    {
+        glfwPostEmptyEvent();
+    }
+}
+
+bool OpenGLWindow::Impl::readFrameBuffer(std::vector<unsigned char> &pixels)
+{
+    if (!offscreen_)
+    {
+        return false;
+    }
+
+    offscreen_->readPixels(pixels);
+
+    return true;
+}
+
+void OpenGLWindow::Impl::setPooledModelMatrix(PooledModelHandle model,
+                                              const glm::mat4 &matrix)
+{
+    // invalidPooledModel is out of range too.
+    if (model >= pooledModels_.size())
+    {
+        return;
+    }
+
+    pooledModels_[model].model = matrix;
+    requestRedraw();
+}
+
+void OpenGLWindow::Impl::setRenderOnDemand(bool onDemand)
+{
+    renderOnDemand_ = onDemand;
+    requestRedraw();
 }
 
 void OpenGLWindow::Impl::setWindowPosition(const glm::ivec2 &position)
@@ -680,6 +1085,8 @@ void OpenGLWindow::Impl::setWindowSize(int width, int height)
 
 void OpenGLWindow::Impl::startRender()
 {
+    Profiler::setThreadName("Main");
+
     timeFrame_ =
         std::make_unique<TimeFrame::TimeFrame>(glfwGetTimerFrequency());
     timeFrame_->start(glfwGetTimerValue());
@@ -689,10 +1096,94 @@ void OpenGLWindow::Impl::startRender()
     timeFrame_->stop();
 }
 
+void OpenGLWindow::Impl::startBenchmark(const Benchmark::CameraPath &path,
+                                        Benchmark::BenchmarkReport &report)
+{
+    benchmarkPath_ = &path;
+    benchmarkReport_ = &report;
+    benchmarkFrame_ = 0;
+
+    glfwSwapInterval(0);
+
+    startRender();
+
+    benchmarkPath_ = nullptr;
+    benchmarkReport_ = nullptr;
+}
+
+void OpenGLWindow::Impl::subscribeEvent(
+    std::unique_ptr<Event::EventHandlerBase> &&handler)
+{
+    eventDispatcher_.subscribe(std::move(handler));
+}
+
 void OpenGLWindow::Impl::updateFrameBufferSize(const glm::ivec2 &frame)
 {
     frameBufferSize_ = frame;
     glViewport(0, 0, frame.x, frame.y);
+
+    if (offscreen_ && isRenderable())
+    {
+        offscreen_->resize(frame);
+    }
+}
+
+bool OpenGLWindow::Impl::uploadModel(Detail::LoadedModel &model,
+                                     OpenGL::OpenGLShaderProgram &program)
+{
+    auto texture{uploadTexture(model)};
+    if (!reportModel(model))
+    {
+        return false;
+    }
+
+    models_.push_back(
+        Model::ModelFactory::createMesh(model.mesh, program, texture));
+
+    return true;
+}
+
+OpenGL::OpenGLTexture *
+OpenGLWindow::Impl::uploadTexture(Detail::LoadedModel &model)
+{
+    if (!model.hasTexture)
+    {
+        return nullptr;
+    }
+
+    auto texture{model.textureLoaded
+                     ? Model::ModelFactory::createTexture(model.image)
+                     : std::make_unique<OpenGL::OpenGLTexture>()};
+    textures.push_back(std::move(texture));
+
+    return textures.back().get();
+}
+
+bool OpenGLWindow::Impl::reportModel(const Detail::LoadedModel &model)
+{
+    if (!model.warning.empty())
+    {
+        std::cerr << "[Warning]\n" << model.warning;
+    }
+
+    if (!model.error.empty())
+    {
+        std::cerr << "[Error]\n" << model.error;
+    }
+
+    if (!model.success)
+    {
+        return false;
+    }
+
+    if (model.report.optimized)
+    {
+        std::cout << StringFormat::StringFormat(
+            "[Info]\nVertex cache ACMR: %.3f -> %.3f\n",
+            model.report.missRatioBefore, model.report.missRatioAfter);
+    }
+
+    return true;
 }
 
 const GLFWwindow &OpenGLWindow::Impl::window() const { return *window_; }
@@ -705,41 +1196,201 @@ float OpenGLWindow::Impl::windowAspectRatio() const
            static_cast<float>(windowHeight());
 }
 
+void OpenGLWindow::Impl::windowFrameBenchmarkUpdate()
+{
+    if (!benchmarkPath_)
+    {
+        return;
+    }
+
+    // The delta time of this frame is the time of the previous one, which
+    // rendered the path at benchmarkFrame_ - 1.
+    const auto warmup{benchmarkPath_->warmupFrameCount()};
+    if (benchmarkFrame_ > warmup)
+    {
+        benchmarkReport_->addFrame(timeFrame_->unscaledDeltaTime(),
+                                   drawCallCount_);
+
+        // Read back a few frames late, so it may include warmup frames.
+        if (gpuResolved_)
+        {
+            std::vector<std::string> scopes;
+            for (const auto &result : gpuProfiler_->results())
+            {
+                // Keyed by path, "Draw" is under both "Queue" and "Instanced".
+                scopes.resize(result.depth);
+                scopes.push_back(
+                    (result.depth ? scopes.back() + "/" : std::string{}) +
+                    result.name);
+                benchmarkReport_->addGpuTime(scopes.back(),
+                                             result.milliseconds);
+            }
+        }
+    }
+
+    // From here on the statistics hold the measured frames only.
+    if (benchmarkFrame_ == warmup)
+    {
+        timeFrame_->statistics().clear();
+    }
+
+    if (benchmarkFrame_ >= warmup + benchmarkPath_->frameCount())
+    {
+        benchmarkReport_->setFrameStatistics(timeFrame_->statistics());
+        glfwSetWindowShouldClose(window_, true);
+        return;
+    }
+
+    const auto camera{benchmarkPath_->sample(
+        benchmarkFrame_ > warmup ? benchmarkFrame_ - warmup : 0)};
+    cameraPosition_ = camera.position;
+    lookAt_ = camera.lookAt;
+
+    ++benchmarkFrame_;
+}
+
 void OpenGLWindow::Impl::windowFrameEventUpdate()
 {
+    PROGRAM_PROFILE_ZONE("windowFrameEventUpdate");
+
     timeFrame_->update(glfwGetTimerValue());
 
-    while (!eventQueue_.empty())
+    // At most one ring of events per frame, other threads may keep pushing
+    // while it drains. The rest waits for the next frame.
+    for (auto remaining{incomingEvents_.capacity()}; remaining; --remaining)
+    {
+        auto event{incomingEvents_.front()};
+        if (!event)
+        {
+            break;
+        }
+
+        eventQueue_.push(std::move(*event));
+        incomingEvents_.pop();
+    }
+
+    if (!eventQueue_.empty())
+    {
+        requestRedraw();
+    }
+
+    while (auto event{eventQueue_.front()})
     {
-        handleEvent(eventQueue_.front().get());
+        handleEvent(event);
         eventQueue_.pop();
     }
 }
 
+void OpenGLWindow::Impl::windowFrameIdle()
+{
+    if (!isIdle())
+    {
+        return;
+    }
+
+    PROGRAM_PROFILE_ZONE("windowFrameIdle");
+
+    while (isIdle() && !glfwWindowShouldClose(window_))
+    {
+        auto before{glfwGetTime()};
+        glfwWaitEventsTimeout(Detail::Constant::idleTimeout);
+
+        // Only an event wakes the wait early. Not every event is queued, the
+        // cursor moves go to ImGui only, so redraw for any of them.
+        if (glfwGetTime() - before < Detail::Constant::idleTimeout)
+        {
+            requestRedraw();
+        }
+    }
+
+    timeFrame_->skip(glfwGetTimerValue());
+}
+
 void OpenGLWindow::Impl::windowFrameLoop()
 {
     while (!(glfwWindowShouldClose(window_)))
     {
+        windowFrameIdle();
+
+        PROGRAM_PROFILE_ZONE("Frame");
+
         windowFrameEventUpdate();
 
+        windowFrameModelUpdate();
+
+        windowFrameBenchmarkUpdate();
+
         clearColor();
 
         windowFrameRender();
 
         windowFrameRenderImguiUpdate();
 
-        glfwSwapBuffers(window_);
-        glfwPollEvents();
+        {
+            PROGRAM_PROFILE_ZONE("glfwSwapBuffers");
+            glfwSwapBuffers(window_);
+        }
+
+        // A request from another thread in between is at most one frame
+        // short.
+        if (redrawFrames_.load(std::memory_order_relaxed))
+        {
+            redrawFrames_.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        {
+            PROGRAM_PROFILE_ZONE("glfwPollEvents");
+            glfwPollEvents();
+        }
+    }
+}
+
+void OpenGLWindow::Impl::windowFrameModelUpdate()
+{
+    PROGRAM_PROFILE_ZONE("windowFrameModelUpdate");
+
+    // Upload at most one finished model per frame to keep the frame time flat
+    // while several models are streaming in.
+    for (auto it{pendingModels_.begin()}; it != pendingModels_.end(); ++it)
+    {
+        if (it->loaded.wait_for(std::chrono::seconds{0}) !=
+            std::future_status::ready)
+        {
+            continue;
+        }
+
+        try
+        {
+            auto model{it->loaded.get()};
+            it->added.set_value(uploadModel(model, *(it->program)));
+        }
+        catch (...)
+        {
+            std::cerr << "[Error]\nFailed to upload " << it->source << "\n";
+            it->added.set_exception(std::current_exception());
+        }
+
+        pendingModels_.erase(it);
+        requestRedraw();
+        return;
     }
 }
 
 void OpenGLWindow::Impl::windowFrameRender()
 {
+    PROGRAM_PROFILE_ZONE("windowFrameRender");
+
+    drawCallCount_ = 0;
+    gpuResolved_ = gpuProfiler_->beginFrame();
+
     if (!isRenderable())
     {
         return;
     }
 
+    Render::GpuScope renderScope{gpuProfiler_.get(), "Render"};
+    auto drawProfiler{gpuDrawScopes_ ? gpuProfiler_.get() : nullptr};
+
     PRAGMA_WARNING_PUSH
     PRAGMA_WARNING_DISABLE_CONSTANTCONDITIONAL
     glm::mat4 view{glm::lookAt(cameraPosition_, lookAt_, glm::vec3{0, 1, 0}) *
@@ -749,26 +1400,169 @@ void OpenGLWindow::Impl::windowFrameRender()
     glm::mat4 projection{glm::perspective(
         glm::radians(45.0f), frameBufferAspectRatio(), 0.1f, 100.0f)};
 
+    OpenGL::OpenGLStateCache::current().resetStatistics();
+
+    culler_.clear();
     for (auto &model : models_)
     {
+        culler_.add(model->boundingBox(), model->boundingSphere(),
+                    model->model());
+    }
+    for (auto &model : pooledModels_)
+    {
+        culler_.add(model.boundingBox, model.boundingSphere, model.model);
+    }
+    culler_.cull(projection * view);
+
+    renderQueue_.clear();
+    for (size_t i{0}; i < models_.size(); ++i)
+    {
+        if (culler_.isVisible(i))
+        {
+            models_[i]->submit(renderQueue_, view);
+        }
+    }
+    renderQueue_.sort();
+    {
+        Render::GpuScope scope{gpuProfiler_.get(), "Queue"};
+        renderQueue_.execute(view, projection, drawProfiler);
+    }
+    drawCallCount_ += renderQueue_.packetCount();
+
+    if (geometryPool_)
+    {
+        Render::GpuScope scope{gpuProfiler_.get(), "Pool"};
+        geometryPool_->clearDraws();
+        for (size_t i{0}; i < pooledModels_.size(); ++i)
+        {
+            const auto &model{pooledModels_[i]};
+            if (culler_.isVisible(models_.size() + i))
+            {
+                geometryPool_->draw(model.mesh, model.model, *(model.program),
+                                    model.texture);
+            }
+        }
+        geometryPool_->execute(view, projection);
+        drawCallCount_ += geometryPool_->batchCount();
+    }
+
+    Render::GpuScope instancedScope{gpuProfiler_.get(), "Instanced"};
+    for (auto &model : instancedModels_)
+    {
+        Render::GpuScope scope{drawProfiler, "Draw"};
         model->draw(view, projection);
+        drawCallCount_ += model->instanceCount() ? 1 : 0;
     }
 }
 
 void OpenGLWindow::Impl::windowFrameRenderImguiUpdate()
 {
+    PROGRAM_PROFILE_ZONE("windowFrameRenderImguiUpdate");
+
     ImGui_ImplOpenGL3_NewFrame();
     ImGui_ImplGlfw_NewFrame();
     ImGui::NewFrame();
 
     windowImguiGeneralSetting();
+    windowImguiFrameStatistics();
+    windowImguiDebugMessages();
+    windowImguiGpuProfiler();
 
     ImGui::Render();
-    ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+    {
+        Render::GpuScope scope{gpuProfiler_.get(), "ImGui"};
+        ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+    }
+
+    // ImGui binds its own program, buffers and textures.
+    OpenGL::OpenGLStateCache::current().invalidate();
+
+    gpuProfiler_->endFrame();
 }
 
 int OpenGLWindow::Impl::windowHeight() const { return windowSize_.y; }
 
+void OpenGLWindow::Impl::windowImguiDebugMessages()
+{
+    ImGui::Begin("Debug messages");
+
+    const char *severities[] = {"Notification", "Low", "Medium", "High"};
+    const GLenum severityValues[] = {
+        GL_DEBUG_SEVERITY_NOTIFICATION, GL_DEBUG_SEVERITY_LOW,
+        GL_DEBUG_SEVERITY_MEDIUM, GL_DEBUG_SEVERITY_HIGH};
+    if (ImGui::Combo("Lowest severity", &debugSeverity_, severities,
+                     IM_ARRAYSIZE(severities)))
+    {
+        Logger::setSeverityThreshold(severityValues[debugSeverity_]);
+    }
+
+    ImGui::Text("Dropped: %zu, untracked: %zu", Logger::droppedCount(),
+                Logger::untrackedCount());
+    for (const auto &counter : Logger::messageCounters())
+    {
+        ImGui::Text("%u: %zu seen, %zu since the last summary", counter.id,
+                    counter.count, counter.suppressed);
+    }
+
+    ImGui::End();
+}
+
+void OpenGLWindow::Impl::windowImguiFrameStatistics()
+{
+    using Detail::Constant::millisecondsPerSecond;
+
+    auto &statistics{timeFrame_->statistics()};
+
+    ImGui::Begin("Frame time");
+
+    ImGui::SliderInt("Window", &statisticsWindow_, 1,
+                     static_cast<int>(statistics.capacity()));
+    const auto summary{
+        statistics.summary(static_cast<size_t>(statisticsWindow_))};
+
+    ImGui::Text("FPS: %.1f (%zu frames)",
+                summary.mean > 0.0 ? 1.0 / summary.mean : 0.0, summary.frames);
+    ImGui::Text("Min / mean / max: %.2f / %.2f / %.2f ms",
+                summary.min * millisecondsPerSecond,
+                summary.mean * millisecondsPerSecond,
+                summary.max * millisecondsPerSecond);
+    ImGui::Text("p50 / p95 / p99: %.2f / %.2f / %.2f ms",
+                summary.p50 * millisecondsPerSecond,
+                summary.p95 * millisecondsPerSecond,
+                summary.p99 * millisecondsPerSecond);
+
+    auto threshold{static_cast<float>(statistics.hitchThreshold() *
+                                      millisecondsPerSecond)};
+    if (ImGui::SliderFloat("Hitch threshold (ms)", &threshold, 1.0f, 200.0f))
+    {
+        statistics.setHitchThreshold(static_cast<double>(threshold) /
+                                     millisecondsPerSecond);
+    }
+    ImGui::Text("Hitches: %zu in %zu frames", statistics.hitchCount(),
+                statistics.totalFrameCount());
+
+    statistics.durations(frameDurations_);
+    ImGui::PlotLines("Frames", frameDurations_.data(),
+                     static_cast<int>(frameDurations_.size()), 0, nullptr,
+                     0.0f, static_cast<float>(2.0 * summary.p99),
+                     ImVec2{0.0f, 60.0f});
+
+    const auto &histogram{statistics.histogram()};
+    frameHistogram_.assign(histogram.begin(), histogram.end());
+    const auto label{StringFormat::StringFormat(
+        "%.0f ms buckets", statistics.bucketWidth() * millisecondsPerSecond)};
+    ImGui::PlotHistogram(label.c_str(), frameHistogram_.data(),
+                         static_cast<int>(frameHistogram_.size()), 0, nullptr,
+                         0.0f, FLT_MAX, ImVec2{0.0f, 60.0f});
+
+    if (ImGui::Button("Clear"))
+    {
+        statistics.clear();
+    }
+
+    ImGui::End();
+}
+
 void OpenGLWindow::Impl::windowImguiGeneralSetting()
 {
     ImGui::Begin("Setting");
@@ -798,7 +1592,70 @@ void OpenGLWindow::Impl::windowImguiGeneralSetting()
                 timeFrame_->unscaledDeltaTime());
     ImGui::Text("Time: [%f, %f]", timeFrame_->time(),
                 timeFrame_->unscaledTime());
-    ImGui::Text("FPS: %f", 1 / timeFrame_->unscaledDeltaTime());
+    ImGui::Text("Models: %zu visible, %zu culled", culler_.visibleCount(),
+                culler_.culledCount());
+    ImGui::Text("Draws: %zu, %zu program and %zu texture changes",
+                renderQueue_.packetCount(), renderQueue_.programChangeCount(),
+                renderQueue_.textureChangeCount());
+    if (geometryPool_)
+    {
+        ImGui::Text("Pool: %zu draws in %zu batches",
+                    geometryPool_->drawCount(), geometryPool_->batchCount());
+    }
+
+    const auto &bindings{OpenGL::OpenGLStateCache::current().statistics()};
+    ImGui::Text("Bindings: %zu issued, %zu skipped", bindings.issued,
+                bindings.skipped);
+    ImGui::Text("Events: %zu coalesced, %zu dropped",
+                eventQueue_.coalescedCount(),
+                incomingEvents_.droppedCount() + eventQueue_.droppedCount());
+
+    auto onDemand{renderOnDemand_};
+    if (ImGui::Checkbox("Render on demand", &onDemand))
+    {
+        setRenderOnDemand(onDemand);
+    }
+
+    auto profiling{Profiler::isEnabled()};
+    if (ImGui::Checkbox("CPU profiler", &profiling))
+    {
+        Profiler::setEnabled(profiling);
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Export trace"))
+    {
+        if (Profiler::exportChromeTrace("trace.json"))
+        {
+            std::cout << "[Info]\nCPU trace written to trace.json\n";
+        }
+        else
+        {
+            std::cerr << "[Error]\nCannot write trace.json\n";
+        }
+    }
+
+    ImGui::End();
+}
+
+void OpenGLWindow::Impl::windowImguiGpuProfiler()
+{
+    ImGui::Begin("GPU");
+
+    auto enabled{gpuProfiler_->isEnabled()};
+    if (ImGui::Checkbox("Enabled", &enabled))
+    {
+        gpuProfiler_->setEnabled(enabled);
+    }
+    ImGui::SameLine();
+    ImGui::Checkbox("Time each draw", &gpuDrawScopes_);
+
+    ImGui::Text("Frame: %.3f ms", gpuProfiler_->frameTime());
+    for (const auto &result : gpuProfiler_->results())
+    {
+        ImGui::Text("%*s%s: %.3f ms (%zu)", static_cast<int>(result.depth * 2),
+                    "", result.name, result.milliseconds, result.count);
+    }
+    ImGui::Text("Dropped frames: %zu", gpuProfiler_->droppedFrameCount());
 
     ImGui::End();
 }
@@ -821,8 +1678,7 @@ void OpenGLWindow::Impl::windowPositionCallback(GLFWwindow *window, int x,
         auto before{who->windowPosition()};
         auto after{glm::ivec2{x, y}};
 
-        who->pushEvent(
-            std::make_unique<Event::MoveEvent>(after, before, time, window));
+        who->pushEvent(Event::MoveEvent{after, before, time, window});
     }
 }
 
@@ -844,8 +1700,7 @@ void OpenGLWindow::Impl::windowSizeCallback(GLFWwindow *window, int width,
         auto before{who->windowSize()};
         auto after{glm::ivec2{width, height}};
 
-        who->pushEvent(std::make_unique<Event::WindowResizeEvent>(
-            after, before, time, window));
+        who->pushEvent(Event::WindowResizeEvent{after, before, time, window});
     }
 }
 
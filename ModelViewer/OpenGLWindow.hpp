@@ -3,18 +3,26 @@
 
 #include "OpenGL/OpenGLLib.hpp"
 
+#include "Benchmark/BenchmarkReport.hpp"
+#include "Benchmark/CameraPath.hpp"
 #include "Event/Event.hpp"
+#include "Event/EventHandlerBase.hpp"
 #include "Event/KeyboardEvent.hpp"
+#include "Event/LoadCompletedEvent.hpp"
 #include "Event/MouseEvent.hpp"
 #include "Event/MoveEvent.hpp"
 #include "Event/ResizeEvent.hpp"
+#include "Model/InstancedMesh.hpp"
 #include "Model/Mesh.hpp"
 #include "OpenGL/OpenGLShaderProgram.hpp"
 #include "OpenGL/OpenGLTexture.hpp"
 
+#include "glm/mat4x4.hpp"
 #include "glm/vec2.hpp"
 
+#include <future>
 #include <memory>
+#include <vector>
 
 class OpenGLWindowBuilder;
 
@@ -29,6 +37,17 @@ class OpenGLWindowBuilder;
 class OpenGLWindow final
 {
 public:
+    /**
+     * \brief Identify a model added by addPooledModel.
+     */
+    using PooledModelHandle = size_t;
+
+    /**
+     * \brief Handle returned by addPooledModel when the model failed to load.
+     */
+    static constexpr PooledModelHandle invalidPooledModel{
+        static_cast<PooledModelHandle>(-1)};
+
     /**
      * \brief Initializes a new instance of the OpenGLWindow class.
      *
@@ -58,6 +77,68 @@ public:
     bool addModel(const char *modelSource, const char *textureSource,
                   OpenGL::OpenGLShaderProgram &program);
 
+    /**
+     * \brief Add model to this scene, loading it on another thread.
+     *
+     * \details The file is parsed in the background. The model is uploaded to
+     * the GPU on a later frame of the render loop, at most one model per
+     * frame, so the future only resolves while the window renders.
+     *
+     * \param modelSource Source of the model.
+     * \param textureSource Texture of the model.
+     * \param program ShaderProgram of the render process for this model. It
+     * must outlive the upload.
+     * \return Future which resolves to \c true once the model is in the
+     * scene, or to \c false if it failed to load or upload. It resolves to
+     * \c false if the window is destroyed before the upload. An exception
+     * thrown by the upload is rethrown by the future.
+     */
+    std::future<bool> addModelAsync(const char *modelSource,
+                                    const char *textureSource,
+                                    OpenGL::OpenGLShaderProgram &program);
+
+    /**
+     * \brief Add model which is drawn once per instance to this scene.
+     *
+     * \param modelSource Source of the model.
+     * \param textureSource Texture of the model.
+     * \param program ShaderProgram of the render process for this model. It
+     * must read the model matrix of each instance as an attribute, like
+     * Shader/InstancedVertexShader.vs.glsl.
+     * \return Requested model without any instance. Add instances to it to
+     * draw it. Return nullptr if the model failed to load.
+     */
+    Model::InstancedMesh *
+    addInstancedModel(const char *modelSource, const char *textureSource,
+                      OpenGL::OpenGLShaderProgram &program);
+
+    /**
+     * \brief Add model stored in the shared geometry pool to this scene.
+     *
+     * \details Models in the pool which share a program and a texture are
+     * drawn with a single \c glMultiDrawElementsIndirect.
+     *
+     * \param modelSource Source of the model.
+     * \param textureSource Texture of the model.
+     * \param program ShaderProgram of the render process for this model. It
+     * must read the model matrix as an attribute, like
+     * Shader/InstancedVertexShader.vs.glsl.
+     * \return Handle of the model, drawn with the identity model matrix
+     * until setPooledModelMatrix is called. Return invalidPooledModel if the
+     * model failed to load.
+     */
+    PooledModelHandle addPooledModel(const char *modelSource,
+                                     const char *textureSource,
+                                     OpenGL::OpenGLShaderProgram &program);
+
+    /**
+     * \brief Sets the model matrix of a pooled model.
+     *
+     * \param model Handle returned by addPooledModel.
+     * \param matrix Specified model matrix.
+     */
+    void setPooledModelMatrix(PooledModelHandle model, const glm::mat4 &matrix);
+
     /**
      * \brief Add shader to the scene.
      *
@@ -76,6 +157,21 @@ public:
      */
     void startRender();
 
+    /**
+     * \brief Render the scene with the camera following \p path, and measure
+     * every frame into \p report.
+     *
+     * \details Vertical sync is turned off, so the frame time is the time
+     * the frame takes. The function returns after the last frame of \p path,
+     * or when the window is closed earlier.
+     *
+     * \param path Specified camera path.
+     * \param report Receives the time and the draw calls of every measured
+     * frame.
+     */
+    void startBenchmark(const Benchmark::CameraPath &path,
+                        Benchmark::BenchmarkReport &report);
+
     /**
      * \brief Get the position of the OpenGLWindow.
      *
@@ -127,6 +223,59 @@ public:
      */
     glm::ivec2 frameBufferSize() const;
 
+    /**
+     * \brief Get whether the OpenGLWindow renders into an offscreen frame
+     * buffer instead of a visible window.
+     *
+     * \return Requested value.
+     *
+     * \sa OpenGLWindowBuilder::setHeadless
+     */
+    bool isHeadless() const;
+
+    /**
+     * \brief Read the last rendered frame back from the offscreen frame
+     * buffer.
+     *
+     * \param pixels Receives the RGBA8 pixels, row by row from the bottom.
+     * \return Return \c false if the OpenGLWindow is not headless.
+     * Otherwise, return \c true.
+     */
+    bool readFrameBuffer(std::vector<unsigned char> &pixels);
+
+    /**
+     * \brief Sets whether the OpenGLWindow renders only when something
+     * changed.
+     *
+     * \details Rendering on demand, the OpenGLWindow waits in
+     * \c glfwWaitEventsTimeout instead of rendering the same frame again. It
+     * renders a few frames after an event, a finished asynchronous load or a
+     * call to requestRedraw. A headless OpenGLWindow and a benchmark always
+     * render continuously. Off by default.
+     *
+     * \param onDemand Specified mode.
+     */
+    void setRenderOnDemand(bool onDemand);
+
+    /**
+     * \brief Get whether the OpenGLWindow renders on demand.
+     *
+     * \return Requested value.
+     *
+     * \sa setRenderOnDemand
+     */
+    bool isRenderOnDemand() const;
+
+    /**
+     * \brief Mark the OpenGLWindow dirty, so it renders the next frames when
+     * rendering on demand.
+     *
+     * Call this function whenever the scene changes outside of an event, and
+     * every frame while an animation runs. It may be called from any thread,
+     * a call from another thread wakes the OpenGLWindow if it waits idle.
+     */
+    void requestRedraw();
+
     /**
      * \brief Get the GLFWwindow of the OpenGLWindow.
      *
@@ -152,9 +301,22 @@ public:
     /**
      * \brief Push the event to event queue.
      *
+     * The event is moved into a preallocated slot of the queue, pushing does
+     * not allocate. If the queue is full, the event is dropped.
+     *
      * \param event Specified event.
      */
-    void pushEvent(std::unique_ptr<Event::Event> &&event);
+    void pushEvent(Event::Event &&event);
+
+    /**
+     * \brief Subscribe \p handler to the events of its type.
+     *
+     * Several handlers may subscribe to the same type. They are called in the
+     * order they subscribed, after the handlers of the OpenGLWindow itself.
+     *
+     * \param handler Specified handler.
+     */
+    void subscribeEvent(std::unique_ptr<Event::EventHandlerBase> &&handler);
 
     /**
      * \brief EventHandler when framebuffer is resized.
@@ -170,6 +332,13 @@ public:
      */
     void keyboardEvent(Event::KeyboardEvent *event);
 
+    /**
+     * \brief EventHandler when a model loaded by addModelAsync is parsed.
+     *
+     * \param event Specified event
+     */
+    void loadCompletedEvent(Event::LoadCompletedEvent *event);
+
     /**
      * \brief EventHandler when mouse is triggered.
      *
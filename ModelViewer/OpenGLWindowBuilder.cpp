@@ -25,12 +25,15 @@ public:
 
     void setTitle(const std::string &title);
 
+    void setHeadless(bool headless);
+
     void reset();
 
     glm::ivec2 productVersion() const;
     glm::ivec2 productPosition() const;
     glm::ivec2 productSize() const;
     std::string productTitle() const;
+    bool productHeadless() const;
 
     std::unique_ptr<OpenGLWindow> build(OpenGLWindowBuilder &me);
 
@@ -39,6 +42,7 @@ private:
     glm::ivec2 position_;
     glm::ivec2 windowSize_;
     std::string title_;
+    bool headless_;
 };
 
 OpenGLWindowBuilder::OpenGLWindowBuilder() : pimpl_{std::make_unique<Impl>()} {}
@@ -55,6 +59,11 @@ glm::ivec2 OpenGLWindowBuilder::productVersion() const
     return pimpl_->productVersion();
 }
 
+bool OpenGLWindowBuilder::productHeadless() const
+{
+    return pimpl_->productHeadless();
+}
+
 glm::ivec2 OpenGLWindowBuilder::productPosition() const
 {
     return pimpl_->productPosition();
@@ -72,6 +81,12 @@ std::string OpenGLWindowBuilder::productTitle() const
 
 void OpenGLWindowBuilder::reset() { pimpl_->reset(); }
 
+OpenGLWindowBuilder &OpenGLWindowBuilder::setHeadless(bool headless)
+{
+    pimpl_->setHeadless(headless);
+    return *this;
+}
+
 OpenGLWindowBuilder &
 OpenGLWindowBuilder::setPosition(const glm::ivec2 &position)
 {
@@ -115,7 +130,7 @@ OpenGLWindowBuilder &OpenGLWindowBuilder::setVersion(int major, int minor)
     return *this;
 }
 
-OpenGLWindowBuilder::Impl::Impl() {}
+OpenGLWindowBuilder::Impl::Impl() : headless_{false} {}
 
 OpenGLWindowBuilder::Impl::~Impl() = default;
 
@@ -155,11 +170,19 @@ glm::ivec2 OpenGLWindowBuilder::Impl::productSize() const
 
 std::string OpenGLWindowBuilder::Impl::productTitle() const { return title_; }
 
+bool OpenGLWindowBuilder::Impl::productHeadless() const { return headless_; }
+
 void OpenGLWindowBuilder::Impl::reset()
 {
     version_ = glm::ivec2{4, 3};
     position_ = glm::ivec2{0, 0};
     windowSize_ = glm::ivec2{800, 600};
+    headless_ = false;
+}
+
+void OpenGLWindowBuilder::Impl::setHeadless(bool headless)
+{
+    headless_ = headless;
 }
 
 void OpenGLWindowBuilder::Impl::setPosition(const glm::ivec2 &position)
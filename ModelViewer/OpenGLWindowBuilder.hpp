@@ -98,6 +98,19 @@ public:
      */
     OpenGLWindowBuilder &setTitle(const std::string &title);
 
+    /**
+     * \brief Sets whether the OpenGLWindow renders without a display.
+     *
+     * \details A headless OpenGLWindow creates a hidden window and renders
+     * into an offscreen frame buffer. When GLFW provides the null platform,
+     * the context comes from Mesa's software rasterizer through OSMesa, so
+     * neither a display server nor a GPU is needed.
+     *
+     * \param headless Specified headless mode.
+     * \return itself
+     */
+    OpenGLWindowBuilder &setHeadless(bool headless);
+
     /**
      * \brief Reset all the setting to the default setting.
      */
@@ -131,6 +144,13 @@ public:
      */
     std::string productTitle() const;
 
+    /**
+     * \brief Get whether the product is headless when this class build it.
+     *
+     * \return Requested value.
+     */
+    bool productHeadless() const;
+
     /**
      * \brief Build the OpenGLWindow based on the setting. Reset the class
      * setting to default once the product is built.
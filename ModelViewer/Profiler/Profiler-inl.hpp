@@ -0,0 +1,22 @@
+namespace Profiler
+{
+
+inline bool isEnabled() noexcept
+{
+    return Detail::enabled.load(std::memory_order_relaxed);
+}
+
+inline ScopedZone::ScopedZone(const char *name) noexcept
+    : name_{isEnabled() ? name : nullptr}, begin_{name_ ? now() : 0}
+{
+}
+
+inline ScopedZone::~ScopedZone()
+{
+    if (name_)
+    {
+        record(name_, begin_, now());
+    }
+}
+
+} // namespace Profiler
@@ -0,0 +1,264 @@
+#include "Profiler.hpp"
+
+#include "Utils/StringFormat/StringFormat.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Profiler
+{
+
+namespace Detail
+{
+
+namespace Constant
+{
+
+constexpr size_t ringCapacity{size_t{1} << 15};
+
+constexpr double microsecondsPerNanosecond{1.0e-3};
+
+} // namespace Constant
+
+// The fields are atomics so the exporter may read a slot while the owner
+// overwrites it; such a slot is then discarded.
+struct Slot
+{
+    std::atomic<const char *> name;
+    std::atomic<uint64_t> begin;
+    std::atomic<uint64_t> end;
+};
+
+struct Zone
+{
+    const char *name;
+    uint64_t begin;
+    uint64_t end;
+};
+
+// Written only by the owning thread. A ring outlives its thread and is handed
+// to the next new thread, so short lived threads such as the model loaders do
+// not allocate a ring each.
+struct ThreadBuffer
+{
+    std::array<Slot, Constant::ringCapacity> slots;
+    std::atomic<uint64_t> head;
+
+    // Guarded by registryMutex.
+    uint64_t start;
+    size_t id;
+    std::string name;
+    bool owned;
+};
+
+struct ThreadBufferHolder
+{
+    ~ThreadBufferHolder();
+
+    ThreadBuffer *buffer{nullptr};
+};
+
+std::atomic<bool> enabled{false};
+
+std::mutex registryMutex;
+std::vector<std::unique_ptr<ThreadBuffer>> registry;
+
+thread_local ThreadBufferHolder localHolder;
+
+const std::chrono::steady_clock::time_point epoch{
+    std::chrono::steady_clock::now()};
+
+ThreadBuffer &localBuffer();
+void readZones(ThreadBuffer &buffer, std::vector<Zone> &zones);
+
+ThreadBufferHolder::~ThreadBufferHolder()
+{
+    if (buffer)
+    {
+        std::lock_guard<std::mutex> lock{registryMutex};
+        buffer->owned = false;
+    }
+}
+
+ThreadBuffer &localBuffer()
+{
+    if (localHolder.buffer)
+    {
+        return *localHolder.buffer;
+    }
+
+    std::lock_guard<std::mutex> lock{registryMutex};
+
+    auto free{std::find_if(
+        registry.begin(), registry.end(),
+        [](const std::unique_ptr<ThreadBuffer> &b) { return !b->owned; })};
+    if (free == registry.end())
+    {
+        auto buffer{std::make_unique<ThreadBuffer>()};
+        buffer->head.store(0, std::memory_order_relaxed);
+        buffer->start = 0;
+        buffer->id = registry.size() + 1;
+        buffer->name = StringFormat::StringFormat("Thread %zu", buffer->id);
+        registry.push_back(std::move(buffer));
+        free = registry.end() - 1;
+    }
+
+    (*free)->owned = true;
+    localHolder.buffer = free->get();
+
+    return *localHolder.buffer;
+}
+
+// Must hold registryMutex.
+void readZones(ThreadBuffer &buffer, std::vector<Zone> &zones)
+{
+    using Constant::ringCapacity;
+
+    const auto head{buffer.head.load(std::memory_order_acquire)};
+    const auto oldest{head > ringCapacity ? head - ringCapacity : 0};
+    auto from{std::max(buffer.start, oldest)};
+
+    const auto first{zones.size()};
+    for (auto i{from}; i < head; ++i)
+    {
+        const auto &slot{buffer.slots[i % ringCapacity]};
+        zones.push_back(Zone{slot.name.load(std::memory_order_relaxed),
+                             slot.begin.load(std::memory_order_relaxed),
+                             slot.end.load(std::memory_order_relaxed)});
+    }
+
+    // Drop the zones the owner overwrote while they were copied. The owner
+    // writes slot after % ringCapacity before it publishes after + 1, so the
+    // oldest valid zone is after + 1 - ringCapacity. The fence orders the
+    // relaxed slot loads above before the head is read again.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const auto after{buffer.head.load(std::memory_order_relaxed)};
+    const auto valid{after + 1 > ringCapacity ? after + 1 - ringCapacity : 0};
+    if (valid > from)
+    {
+        const auto overwritten{std::min(valid - from, head - from)};
+        zones.erase(zones.begin() + static_cast<ptrdiff_t>(first),
+                    zones.begin() +
+                        static_cast<ptrdiff_t>(first + overwritten));
+    }
+}
+
+} // namespace Detail
+
+void setEnabled(bool enabled) noexcept
+{
+    Detail::enabled.store(enabled, std::memory_order_relaxed);
+}
+
+uint64_t now() noexcept
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - Detail::epoch)
+            .count());
+}
+
+void record(const char *name, uint64_t begin, uint64_t end) noexcept
+{
+    auto &buffer{Detail::localBuffer()};
+
+    const auto head{buffer.head.load(std::memory_order_relaxed)};
+    auto &slot{buffer.slots[head % Detail::Constant::ringCapacity]};
+    slot.name.store(name, std::memory_order_relaxed);
+    slot.begin.store(begin, std::memory_order_relaxed);
+    slot.end.store(end, std::memory_order_relaxed);
+    buffer.head.store(head + 1, std::memory_order_release);
+}
+
+void setThreadName(const std::string &name)
+{
+    auto &buffer{Detail::localBuffer()};
+
+    std::lock_guard<std::mutex> lock{Detail::registryMutex};
+    buffer.name = name;
+}
+
+void clear()
+{
+    std::lock_guard<std::mutex> lock{Detail::registryMutex};
+    for (auto &buffer : Detail::registry)
+    {
+        buffer->start = buffer->head.load(std::memory_order_acquire);
+    }
+}
+
+size_t droppedZoneCount()
+{
+    std::lock_guard<std::mutex> lock{Detail::registryMutex};
+
+    size_t dropped{0};
+    for (auto &buffer : Detail::registry)
+    {
+        const auto head{buffer->head.load(std::memory_order_acquire)};
+        if (head > buffer->start + Detail::Constant::ringCapacity)
+        {
+            dropped += static_cast<size_t>(head - buffer->start -
+                                           Detail::Constant::ringCapacity);
+        }
+    }
+
+    return dropped;
+}
+
+std::string chromeTrace()
+{
+    using Detail::Constant::microsecondsPerNanosecond;
+
+    std::string json{"{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n"};
+    auto separator{""};
+
+    std::lock_guard<std::mutex> lock{Detail::registryMutex};
+
+    std::vector<Detail::Zone> zones;
+    for (auto &buffer : Detail::registry)
+    {
+        json += StringFormat::StringFormat(
+            "%s{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, "
+            "\"tid\": %zu, \"args\": {\"name\": \"%s\"}}",
+            separator, buffer->id, buffer->name.c_str());
+        separator = ",\n";
+
+        zones.clear();
+        Detail::readZones(*buffer, zones);
+        for (const auto &zone : zones)
+        {
+            json += StringFormat::StringFormat(
+                ",\n{\"name\": \"%s\", \"ph\": \"X\", \"pid\": 1, "
+                "\"tid\": %zu, \"ts\": %.3f, \"dur\": %.3f}",
+                zone.name, buffer->id,
+                static_cast<double>(zone.begin) * microsecondsPerNanosecond,
+                static_cast<double>(zone.end - zone.begin) *
+                    microsecondsPerNanosecond);
+        }
+    }
+
+    json += "\n]}\n";
+
+    return json;
+}
+
+bool exportChromeTrace(const char *fileName)
+{
+    std::ofstream file{fileName, std::ios::out | std::ios::trunc};
+    if (!file)
+    {
+        return false;
+    }
+
+    file << chromeTrace();
+
+    return static_cast<bool>(file);
+}
+
+} // namespace Profiler
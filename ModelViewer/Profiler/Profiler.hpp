@@ -0,0 +1,133 @@
+#ifndef MODELVIEWER_PROFILER_PROFILER_HPP_
+#define MODELVIEWER_PROFILER_PROFILER_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * \brief This namespace represents the CPU profiler.
+ *
+ * \details Zones are recorded into a ring buffer of the calling thread. Only
+ * the owning thread writes a ring, so recording takes no lock; the exporter
+ * reads every ring and skips the zones overwritten while it was reading. A
+ * ring keeps the latest zones of its thread, older ones are dropped.
+ *
+ * Timestamps come from \c std::chrono::steady_clock, in nanoseconds since the
+ * first use of the profiler.
+ *
+ * The profiler starts disabled. A disabled zone costs one relaxed atomic
+ * load. Define \c PROGRAM_PROFILER_DISABLED to compile the zones out.
+ */
+namespace Profiler
+{
+
+/**
+ * \brief Turn recording on or off for every thread.
+ */
+void setEnabled(bool enabled) noexcept;
+
+bool isEnabled() noexcept;
+
+/**
+ * \brief Gets the current timestamp.
+ *
+ * \return Nanoseconds since the first use of the profiler.
+ */
+uint64_t now() noexcept;
+
+/**
+ * \brief Record a zone of the calling thread.
+ *
+ * \param name Name of the zone. It must outlive the profiler, use string
+ * literals.
+ * \param begin Timestamp when the zone began.
+ * \param end Timestamp when the zone ended.
+ */
+void record(const char *name, uint64_t begin, uint64_t end) noexcept;
+
+/**
+ * \brief Name the calling thread in the exported trace.
+ */
+void setThreadName(const std::string &name);
+
+/**
+ * \brief Forget every recorded zone.
+ */
+void clear();
+
+/**
+ * \brief Gets the number of zones overwritten before they were exported.
+ */
+size_t droppedZoneCount();
+
+/**
+ * \brief Gets the recorded zones as Chrome \c trace_event JSON, which
+ * chrome://tracing and Perfetto open.
+ *
+ * \return Requested value.
+ */
+std::string chromeTrace();
+
+/**
+ * \brief Write chromeTrace to \p fileName.
+ *
+ * \return Return \c true if the file is written. Otherwise, return \c false.
+ */
+bool exportChromeTrace(const char *fileName);
+
+/**
+ * \brief This class records a zone from its construction to its destruction,
+ * if the profiler is enabled on construction.
+ */
+class ScopedZone
+{
+public:
+    explicit ScopedZone(const char *name) noexcept;
+    ~ScopedZone();
+
+    ScopedZone(const ScopedZone &other) = delete;
+    ScopedZone(ScopedZone &&other) = delete;
+    ScopedZone &operator=(const ScopedZone &other) = delete;
+    ScopedZone &operator=(ScopedZone &&other) = delete;
+
+private:
+    const char *name_;
+    uint64_t begin_;
+};
+
+namespace Detail
+{
+
+extern std::atomic<bool> enabled;
+
+} // namespace Detail
+
+} // namespace Profiler
+
+// clang-format off
+
+#define PROGRAM_PROFILE_CONCAT_IMPL(x, y) x##y
+#define PROGRAM_PROFILE_CONCAT(x, y) PROGRAM_PROFILE_CONCAT_IMPL(x, y)
+
+/**
+ * \def PROGRAM_PROFILE_ZONE(name)
+ *
+ * \brief Record a zone named \c name until the end of the enclosing scope.
+ */
+#ifndef PROGRAM_PROFILER_DISABLED
+    #define PROGRAM_PROFILE_ZONE(name)                                         \
+        ::Profiler::ScopedZone PROGRAM_PROFILE_CONCAT(profileZone, __LINE__)   \
+        {                                                                      \
+            (name)                                                             \
+        }
+#else
+    #define PROGRAM_PROFILE_ZONE(name) ((void)(0))
+#endif
+
+// clang-format on
+
+#include "Profiler-inl.hpp"
+
+#endif // MODELVIEWER_PROFILER_PROFILER_HPP_
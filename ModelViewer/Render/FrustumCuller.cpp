@@ -0,0 +1,229 @@
+#include "FrustumCuller.hpp"
+
+#include "Utils/PreDefine.hpp"
+
+#include <cmath>
+
+#include <algorithm>
+
+#if defined(__SSE__) || defined(_M_X64) ||                                     \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+    #define PROGRAM_DETAIL_FRUSTUMCULLER_SSE
+    #include <xmmintrin.h>
+#endif
+
+namespace Render
+{
+
+namespace Detail
+{
+
+namespace Constant
+{
+
+constexpr size_t batchSize{4};
+
+} // namespace Constant
+
+} // namespace Detail
+
+FrustumCuller::FrustumCuller()
+    : planes_{}, centerX_{}, centerY_{}, centerZ_{}, extentX_{}, extentY_{},
+      extentZ_{}, radius_{}, visible_{}, visibleCount_{0}
+{
+}
+
+size_t FrustumCuller::add(const Model::BoundingBox &box,
+                          const Model::BoundingSphere &sphere,
+                          const glm::mat4 &model)
+{
+    const auto center{(box.minimum + box.maximum) * 0.5f};
+    const auto extent{(box.maximum - box.minimum) * 0.5f};
+
+    float worldCenter[3];
+    float worldExtent[3];
+    for (int row{0}; row < 3; ++row)
+    {
+        worldCenter[row] = model[0][row] * center.x +
+                           model[1][row] * center.y +
+                           model[2][row] * center.z + model[3][row];
+        worldExtent[row] = std::fabs(model[0][row]) * extent.x +
+                           std::fabs(model[1][row]) * extent.y +
+                           std::fabs(model[2][row]) * extent.z;
+    }
+
+    float scaleSquared{0.0f};
+    for (int column{0}; column < 3; ++column)
+    {
+        scaleSquared = std::max(scaleSquared,
+                                model[column][0] * model[column][0] +
+                                    model[column][1] * model[column][1] +
+                                    model[column][2] * model[column][2]);
+    }
+
+    centerX_.push_back(worldCenter[0]);
+    centerY_.push_back(worldCenter[1]);
+    centerZ_.push_back(worldCenter[2]);
+    extentX_.push_back(worldExtent[0]);
+    extentY_.push_back(worldExtent[1]);
+    extentZ_.push_back(worldExtent[2]);
+    radius_.push_back(sphere.radius * std::sqrt(scaleSquared));
+    visible_.push_back(1);
+
+    return radius_.size() - 1;
+}
+
+void FrustumCuller::clear()
+{
+    centerX_.clear();
+    centerY_.clear();
+    centerZ_.clear();
+    extentX_.clear();
+    extentY_.clear();
+    extentZ_.clear();
+    radius_.clear();
+    visible_.clear();
+    visibleCount_ = 0;
+}
+
+size_t FrustumCuller::cull(const glm::mat4 &viewProjection)
+{
+    extractPlanes(viewProjection);
+
+    const size_t count{objectCount()};
+    const size_t batched{count - count % Detail::Constant::batchSize};
+
+    cullSimd(0, batched);
+    cullScalar(batched, count);
+
+    visibleCount_ = static_cast<size_t>(
+        std::count(visible_.begin(), visible_.end(), uint8_t{1}));
+
+    return visibleCount_;
+}
+
+size_t FrustumCuller::culledCount() const noexcept
+{
+    return objectCount() - visibleCount_;
+}
+
+void FrustumCuller::cullScalar(size_t begin, size_t end)
+{
+    for (size_t i{begin}; i < end; ++i)
+    {
+        bool outside{false};
+
+        for (const auto &plane : planes_)
+        {
+            const float distance{plane.x * centerX_[i] + plane.y * centerY_[i] +
+                                 plane.z * centerZ_[i] + plane.w};
+            const float reach{std::fabs(plane.x) * extentX_[i] +
+                              std::fabs(plane.y) * extentY_[i] +
+                              std::fabs(plane.z) * extentZ_[i]};
+
+            if (distance < -radius_[i] || distance + reach < 0.0f)
+            {
+                outside = true;
+                break;
+            }
+        }
+
+        visible_[i] = outside ? 0 : 1;
+    }
+}
+
+#if defined(PROGRAM_DETAIL_FRUSTUMCULLER_SSE)
+
+void FrustumCuller::cullSimd(size_t begin, size_t end)
+{
+    const __m128 signMask{_mm_set1_ps(-0.0f)};
+    const __m128 zero{_mm_setzero_ps()};
+
+    for (size_t i{begin}; i < end; i += Detail::Constant::batchSize)
+    {
+        const __m128 centerX{_mm_loadu_ps(&centerX_[i])};
+        const __m128 centerY{_mm_loadu_ps(&centerY_[i])};
+        const __m128 centerZ{_mm_loadu_ps(&centerZ_[i])};
+        const __m128 extentX{_mm_loadu_ps(&extentX_[i])};
+        const __m128 extentY{_mm_loadu_ps(&extentY_[i])};
+        const __m128 extentZ{_mm_loadu_ps(&extentZ_[i])};
+        const __m128 negativeRadius{
+            _mm_xor_ps(_mm_loadu_ps(&radius_[i]), signMask)};
+
+        __m128 outside{zero};
+
+        for (const auto &plane : planes_)
+        {
+            const __m128 x{_mm_set1_ps(plane.x)};
+            const __m128 y{_mm_set1_ps(plane.y)};
+            const __m128 z{_mm_set1_ps(plane.z)};
+
+            const __m128 distance{_mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(x, centerX), _mm_mul_ps(y, centerY)),
+                _mm_add_ps(_mm_mul_ps(z, centerZ), _mm_set1_ps(plane.w)))};
+
+            const __m128 reach{_mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(_mm_andnot_ps(signMask, x), extentX),
+                           _mm_mul_ps(_mm_andnot_ps(signMask, y), extentY)),
+                _mm_mul_ps(_mm_andnot_ps(signMask, z), extentZ))};
+
+            outside = _mm_or_ps(
+                outside,
+                _mm_or_ps(_mm_cmplt_ps(distance, negativeRadius),
+                          _mm_cmplt_ps(_mm_add_ps(distance, reach), zero)));
+        }
+
+        const int mask{_mm_movemask_ps(outside)};
+        for (size_t lane{0}; lane < Detail::Constant::batchSize; ++lane)
+        {
+            visible_[i + lane] = ((mask >> lane) & 1) ? 0 : 1;
+        }
+    }
+}
+
+#else
+
+void FrustumCuller::cullSimd(size_t begin, size_t end)
+{
+    cullScalar(begin, end);
+}
+
+#endif
+
+void FrustumCuller::extractPlanes(const glm::mat4 &viewProjection)
+{
+    // Gribb-Hartmann: every plane is the fourth row plus or minus another row.
+    auto row{[&viewProjection](int i) {
+        return glm::vec4{viewProjection[0][i], viewProjection[1][i],
+                         viewProjection[2][i], viewProjection[3][i]};
+    }};
+
+    const auto w{row(3)};
+    planes_[0] = w + row(0); // Left
+    planes_[1] = w - row(0); // Right
+    planes_[2] = w + row(1); // Bottom
+    planes_[3] = w - row(1); // Top
+    planes_[4] = w + row(2); // Near
+    planes_[5] = w - row(2); // Far
+
+    for (auto &plane : planes_)
+    {
+        const float length{std::sqrt(plane.x * plane.x + plane.y * plane.y +
+                                     plane.z * plane.z)};
+        if (length > 0.0f)
+        {
+            plane /= length;
+        }
+    }
+}
+
+bool FrustumCuller::isVisible(size_t index) const noexcept
+{
+    return visible_[index];
+}
+
+size_t FrustumCuller::objectCount() const noexcept { return radius_.size(); }
+
+size_t FrustumCuller::visibleCount() const noexcept { return visibleCount_; }
+
+} // namespace Render
@@ -0,0 +1,83 @@
+#ifndef MODELVIEWER_RENDER_FRUSTUMCULLER_HPP_
+#define MODELVIEWER_RENDER_FRUSTUMCULLER_HPP_
+
+#include "Model/BoundingBox.hpp"
+#include "Model/BoundingSphere.hpp"
+
+#include "glm/mat4x4.hpp"
+#include "glm/vec4.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Render
+{
+
+/**
+ * \brief This class tests bounding volumes against the view frustum.
+ *
+ * \details Bounds are transformed to world space when they are added and
+ * stored as structure of arrays. cull tests them in batches of four with SSE
+ * when it is available, and with scalar code otherwise. An object is culled if
+ * either its sphere or its box lies completely outside one of the planes.
+ */
+class FrustumCuller
+{
+public:
+    explicit FrustumCuller();
+
+    /**
+     * \brief Remove every object added since the last call.
+     */
+    void clear();
+
+    /**
+     * \brief Add an object with its model space bounds.
+     *
+     * \param box Model space bounding box.
+     * \param sphere Model space bounding sphere, centered on \p box.
+     * \param model Model matrix of the object.
+     * \return Index of the object, in adding order.
+     */
+    size_t add(const Model::BoundingBox &box,
+               const Model::BoundingSphere &sphere, const glm::mat4 &model);
+
+    /**
+     * \brief Test every object against the frustum of \p viewProjection.
+     *
+     * \param viewProjection Projection matrix multiplied by view matrix.
+     * \return Number of visible objects.
+     */
+    size_t cull(const glm::mat4 &viewProjection);
+
+    bool isVisible(size_t index) const noexcept;
+
+    size_t objectCount() const noexcept;
+    size_t visibleCount() const noexcept;
+    size_t culledCount() const noexcept;
+
+private:
+    void extractPlanes(const glm::mat4 &viewProjection);
+
+    void cullScalar(size_t begin, size_t end);
+    void cullSimd(size_t begin, size_t end);
+
+    std::array<glm::vec4, 6> planes_;
+
+    std::vector<float> centerX_;
+    std::vector<float> centerY_;
+    std::vector<float> centerZ_;
+    std::vector<float> extentX_;
+    std::vector<float> extentY_;
+    std::vector<float> extentZ_;
+    std::vector<float> radius_;
+
+    std::vector<uint8_t> visible_;
+    size_t visibleCount_;
+};
+
+} // namespace Render
+
+#endif // MODELVIEWER_RENDER_FRUSTUMCULLER_HPP_
@@ -0,0 +1,465 @@
+#include "GeometryPool.hpp"
+
+#include "Model/Vertex.hpp"
+#include "OpenGL/OpenGLStateCache.hpp"
+#include "Utils/PreDefine.hpp"
+
+#include "glm/vec4.hpp"
+
+#include <algorithm>
+#include <cstddef>
+
+namespace Render
+{
+
+namespace Detail
+{
+
+namespace Constant
+{
+
+constexpr GLuint instanceAttribute{3};
+constexpr GLuint instanceAttributeCount{4};
+
+// Pages double up to this size, about 48 MB of buffers.
+constexpr size_t maximumPageVertexCount{size_t{1} << 20};
+constexpr size_t maximumPageIndexCount{size_t{1} << 22};
+
+} // namespace Constant
+
+// Layout defined by glMultiDrawElementsIndirect.
+struct DrawElementsIndirectCommand
+{
+    GLuint count;
+    GLuint instanceCount;
+    GLuint firstIndex;
+    GLint baseVertex;
+    GLuint baseInstance;
+};
+
+struct Range
+{
+    size_t page;
+    GLint baseVertex;
+    GLuint firstIndex;
+    GLuint indexCount;
+};
+
+struct Page
+{
+    std::unique_ptr<OpenGL::OpenGLVertexArrayObject> vertexArray;
+    std::unique_ptr<OpenGL::OpenGLBufferObject> vertexBuffer;
+    std::unique_ptr<OpenGL::OpenGLBufferObject> elementBuffer;
+
+    size_t vertexCapacity;
+    size_t vertexCount;
+    size_t indexCapacity;
+    size_t indexCount;
+};
+
+// The location is looked up once per program, not for every batch.
+struct ProgramLocation
+{
+    const OpenGL::OpenGLShaderProgram *program;
+    OpenGL::UniformLocation viewProjection;
+};
+
+struct Draw
+{
+    OpenGL::OpenGLShaderProgram *program;
+    OpenGL::OpenGLTexture *texture;
+    size_t page;
+    GeometryPool::Handle mesh;
+    glm::mat4 model;
+};
+
+bool drawOrder(const Draw &x, const Draw &y) noexcept;
+bool isSameBatch(const Draw &x, const Draw &y) noexcept;
+void mapAttribute(GLuint index, GLint size, GLsizei stride, size_t offset,
+                  GLuint divisor);
+size_t nextPageCount(size_t count, size_t maximum) noexcept;
+
+bool drawOrder(const Draw &x, const Draw &y) noexcept
+{
+    if (x.program != y.program)
+    {
+        return x.program->id() < y.program->id();
+    }
+
+    if (x.texture != y.texture)
+    {
+        return (x.texture ? x.texture->id() : 0) <
+               (y.texture ? y.texture->id() : 0);
+    }
+
+    return x.page < y.page;
+}
+
+bool isSameBatch(const Draw &x, const Draw &y) noexcept
+{
+    return x.program == y.program && x.texture == y.texture &&
+           x.page == y.page;
+}
+
+void mapAttribute(GLuint index, GLint size, GLsizei stride, size_t offset,
+                  GLuint divisor)
+{
+    glEnableVertexAttribArray(index);
+    glVertexAttribPointer(index, size, GL_FLOAT, GL_FALSE, stride,
+                          PROGRAM_BUFFER_OFFSET(offset));
+    glVertexAttribDivisor(index, divisor);
+}
+
+// A page given larger than maximum keeps its size.
+size_t nextPageCount(size_t count, size_t maximum) noexcept
+{
+    return std::max(count, std::min(count * 2, maximum));
+}
+
+} // namespace Detail
+
+class GeometryPool::Impl
+{
+public:
+    explicit Impl(size_t pageVertexCount, size_t pageIndexCount);
+    ~Impl() = default;
+
+    Impl(Impl &&other) noexcept = delete;
+    Impl &operator=(Impl &&other) noexcept = delete;
+    Impl(const Impl &other) = delete;
+    Impl &operator=(const Impl &other) = delete;
+
+    Handle add(const Model::MeshData &data);
+
+    void clearDraws();
+    void draw(Handle mesh, const glm::mat4 &model,
+              OpenGL::OpenGLShaderProgram &program,
+              OpenGL::OpenGLTexture *texture);
+    void execute(const glm::mat4 &view, const glm::mat4 &projection);
+
+    size_t meshCount() const noexcept;
+    size_t pageCount() const noexcept;
+    size_t drawCount() const noexcept;
+    size_t batchCount() const noexcept;
+
+private:
+    size_t findPage(size_t vertexCount, size_t indexCount);
+    void createPage(size_t vertexCapacity, size_t indexCapacity);
+    void uploadDraws();
+    OpenGL::UniformLocation
+    viewProjectionLocation(const OpenGL::OpenGLShaderProgram &program);
+
+    size_t pageVertexCount_;
+    size_t pageIndexCount_;
+
+    std::vector<Detail::Page> pages_;
+    std::vector<Detail::Range> ranges_;
+    std::vector<Detail::ProgramLocation> programLocations_;
+
+    std::unique_ptr<OpenGL::OpenGLBufferObject> instanceBuffer_;
+    std::unique_ptr<OpenGL::OpenGLBufferObject> commandBuffer_;
+
+    std::vector<Detail::Draw> draws_;
+    std::vector<glm::mat4> models_;
+    std::vector<Detail::DrawElementsIndirectCommand> commands_;
+
+    size_t batchCount_;
+};
+
+GeometryPool::GeometryPool(size_t pageVertexCount, size_t pageIndexCount)
+    : pimpl_{std::make_unique<Impl>(pageVertexCount, pageIndexCount)}
+{
+}
+
+GeometryPool::GeometryPool(GeometryPool &&other) noexcept = default;
+
+GeometryPool &GeometryPool::operator=(GeometryPool &&other) noexcept = default;
+
+GeometryPool::~GeometryPool() = default;
+
+GeometryPool::Handle GeometryPool::add(const Model::MeshData &data)
+{
+    return pimpl_->add(data);
+}
+
+size_t GeometryPool::batchCount() const noexcept
+{
+    return pimpl_->batchCount();
+}
+
+void GeometryPool::clearDraws() { pimpl_->clearDraws(); }
+
+void GeometryPool::draw(Handle mesh, const glm::mat4 &model,
+                        OpenGL::OpenGLShaderProgram &program,
+                        OpenGL::OpenGLTexture *texture)
+{
+    pimpl_->draw(mesh, model, program, texture);
+}
+
+size_t GeometryPool::drawCount() const noexcept
+{
+    return pimpl_->drawCount();
+}
+
+void GeometryPool::execute(const glm::mat4 &view, const glm::mat4 &projection)
+{
+    pimpl_->execute(view, projection);
+}
+
+size_t GeometryPool::meshCount() const noexcept
+{
+    return pimpl_->meshCount();
+}
+
+size_t GeometryPool::pageCount() const noexcept
+{
+    return pimpl_->pageCount();
+}
+
+GeometryPool::Impl::Impl(size_t pageVertexCount, size_t pageIndexCount)
+    : pageVertexCount_{pageVertexCount}, pageIndexCount_{pageIndexCount},
+      pages_{}, ranges_{}, programLocations_{},
+      instanceBuffer_{std::make_unique<OpenGL::OpenGLBufferObject>(
+          OpenGL::OpenGLBufferObject::Type::ArrayBuffer,
+          OpenGL::OpenGLBufferObject::UsagePattern::StreamDraw)},
+      commandBuffer_{std::make_unique<OpenGL::OpenGLBufferObject>(
+          OpenGL::OpenGLBufferObject::Type::DrawIndirectBuffer,
+          OpenGL::OpenGLBufferObject::UsagePattern::StreamDraw)},
+      draws_{}, models_{}, commands_{}, batchCount_{0}
+{
+}
+
+GeometryPool::Handle GeometryPool::Impl::add(const Model::MeshData &data)
+{
+    const auto page{findPage(data.vertexCount(), data.indexCount())};
+    auto &target{pages_[page]};
+
+    target.vertexArray->bind();
+
+    target.vertexBuffer->bind();
+    target.vertexBuffer->writeBufferData(
+        static_cast<GLintptr>(sizeof(Model::Vertex) * target.vertexCount),
+        data.vertices(),
+        static_cast<GLsizeiptr>(sizeof(Model::Vertex) * data.vertexCount()));
+
+    // The element buffer is part of the vertex array state.
+    target.elementBuffer->bind();
+    target.elementBuffer->writeBufferData(
+        static_cast<GLintptr>(sizeof(Model::MeshData::IndexType) *
+                              target.indexCount),
+        data.indices(),
+        static_cast<GLsizeiptr>(sizeof(Model::MeshData::IndexType) *
+                                data.indexCount()));
+
+    target.vertexArray->release();
+
+    ranges_.push_back(Detail::Range{
+        page, static_cast<GLint>(target.vertexCount),
+        static_cast<GLuint>(target.indexCount),
+        static_cast<GLuint>(data.indexCount())});
+
+    target.vertexCount += data.vertexCount();
+    target.indexCount += data.indexCount();
+
+    return ranges_.size() - 1;
+}
+
+size_t GeometryPool::Impl::batchCount() const noexcept { return batchCount_; }
+
+void GeometryPool::Impl::clearDraws() { draws_.clear(); }
+
+void GeometryPool::Impl::createPage(size_t vertexCapacity,
+                                    size_t indexCapacity)
+{
+    Detail::Page page{
+        std::make_unique<OpenGL::OpenGLVertexArrayObject>(),
+        std::make_unique<OpenGL::OpenGLBufferObject>(
+            OpenGL::OpenGLBufferObject::Type::ArrayBuffer,
+            OpenGL::OpenGLBufferObject::UsagePattern::StaticDraw),
+        std::make_unique<OpenGL::OpenGLBufferObject>(
+            OpenGL::OpenGLBufferObject::Type::ElementArrayBuffer,
+            OpenGL::OpenGLBufferObject::UsagePattern::StaticDraw),
+        vertexCapacity,
+        0,
+        indexCapacity,
+        0};
+
+    page.vertexArray->bind();
+
+    page.vertexBuffer->bind();
+    page.vertexBuffer->allocateBufferData(
+        nullptr,
+        static_cast<GLsizeiptr>(sizeof(Model::Vertex) * vertexCapacity));
+    Detail::mapAttribute(0, 3, sizeof(Model::Vertex),
+                         offsetof(Model::Vertex, position), 0);
+    Detail::mapAttribute(1, 3, sizeof(Model::Vertex),
+                         offsetof(Model::Vertex, normal), 0);
+    Detail::mapAttribute(2, 2, sizeof(Model::Vertex),
+                         offsetof(Model::Vertex, textureCoordinate), 0);
+
+    page.elementBuffer->bind();
+    page.elementBuffer->allocateBufferData(
+        nullptr, static_cast<GLsizeiptr>(sizeof(Model::MeshData::IndexType) *
+                                         indexCapacity));
+
+    // Every page reads the model matrices from the same instance buffer.
+    instanceBuffer_->bind();
+    for (GLuint column{0}; column < Detail::Constant::instanceAttributeCount;
+         ++column)
+    {
+        Detail::mapAttribute(Detail::Constant::instanceAttribute + column, 4,
+                             sizeof(glm::mat4), sizeof(glm::vec4) * column, 1);
+    }
+
+    page.vertexArray->release();
+
+    pages_.push_back(std::move(page));
+}
+
+void GeometryPool::Impl::draw(Handle mesh, const glm::mat4 &model,
+                              OpenGL::OpenGLShaderProgram &program,
+                              OpenGL::OpenGLTexture *texture)
+{
+    PROGRAM_ASSERT(mesh < ranges_.size());
+
+    draws_.push_back(
+        Detail::Draw{&program, texture, ranges_[mesh].page, mesh, model});
+}
+
+size_t GeometryPool::Impl::drawCount() const noexcept { return draws_.size(); }
+
+void GeometryPool::Impl::execute(const glm::mat4 &view,
+                                 const glm::mat4 &projection)
+{
+    batchCount_ = 0;
+    if (draws_.empty())
+    {
+        return;
+    }
+
+    std::sort(draws_.begin(), draws_.end(), Detail::drawOrder);
+    uploadDraws();
+
+    const glm::mat4 viewProjection{projection * view};
+    auto &cache{OpenGL::OpenGLStateCache::current()};
+
+    OpenGL::OpenGLShaderProgram *program{nullptr};
+
+    commandBuffer_->bind();
+    for (size_t begin{0}, end{0}; begin < draws_.size(); begin = end)
+    {
+        end = begin + 1;
+        while (end < draws_.size() &&
+               Detail::isSameBatch(draws_[begin], draws_[end]))
+        {
+            ++end;
+        }
+
+        // The draws are sorted by program, it changes once per program.
+        const auto &first{draws_[begin]};
+        if (first.program != program)
+        {
+            program = first.program;
+            program->use();
+            program->setValue<4, 4>(viewProjectionLocation(*program),
+                                    viewProjection, false);
+        }
+
+        if (first.texture)
+        {
+            cache.activeTexture(GL_TEXTURE0);
+            first.texture->bind();
+        }
+
+        pages_[first.page].vertexArray->bind();
+        glMultiDrawElementsIndirect(
+            GL_TRIANGLES, GL_UNSIGNED_INT,
+            PROGRAM_BUFFER_OFFSET(
+                sizeof(Detail::DrawElementsIndirectCommand) * begin),
+            static_cast<GLsizei>(end - begin), 0);
+        ++batchCount_;
+    }
+}
+
+size_t GeometryPool::Impl::findPage(size_t vertexCount, size_t indexCount)
+{
+    for (size_t i{0}; i < pages_.size(); ++i)
+    {
+        const auto &page{pages_[i]};
+        if (page.vertexCapacity - page.vertexCount >= vertexCount &&
+            page.indexCapacity - page.indexCount >= indexCount)
+        {
+            return i;
+        }
+    }
+
+    createPage(std::max(vertexCount, pageVertexCount_),
+               std::max(indexCount, pageIndexCount_));
+
+    pageVertexCount_ = Detail::nextPageCount(
+        pageVertexCount_, Detail::Constant::maximumPageVertexCount);
+    pageIndexCount_ = Detail::nextPageCount(
+        pageIndexCount_, Detail::Constant::maximumPageIndexCount);
+
+    return pages_.size() - 1;
+}
+
+size_t GeometryPool::Impl::meshCount() const noexcept
+{
+    return ranges_.size();
+}
+
+size_t GeometryPool::Impl::pageCount() const noexcept
+{
+    return pages_.size();
+}
+
+void GeometryPool::Impl::uploadDraws()
+{
+    models_.clear();
+    commands_.clear();
+
+    for (const auto &draw : draws_)
+    {
+        const auto &range{ranges_[draw.mesh]};
+
+        // The base instance picks the model matrix of the draw.
+        commands_.push_back(Detail::DrawElementsIndirectCommand{
+            range.indexCount, 1, range.firstIndex, range.baseVertex,
+            static_cast<GLuint>(models_.size())});
+        models_.push_back(draw.model);
+    }
+
+    // Orphan the previous storage instead of waiting for the GPU to finish
+    // reading it.
+    const auto modelSize{
+        static_cast<GLsizeiptr>(sizeof(glm::mat4) * models_.size())};
+    instanceBuffer_->bind();
+    instanceBuffer_->allocateBufferData(nullptr, modelSize);
+    instanceBuffer_->writeBufferData(0, models_.data(), modelSize);
+
+    const auto commandSize{static_cast<GLsizeiptr>(
+        sizeof(Detail::DrawElementsIndirectCommand) * commands_.size())};
+    commandBuffer_->bind();
+    commandBuffer_->allocateBufferData(nullptr, commandSize);
+    commandBuffer_->writeBufferData(0, commands_.data(), commandSize);
+}
+
+OpenGL::UniformLocation GeometryPool::Impl::viewProjectionLocation(
+    const OpenGL::OpenGLShaderProgram &program)
+{
+    for (const auto &location : programLocations_)
+    {
+        if (location.program == &program)
+        {
+            return location.viewProjection;
+        }
+    }
+
+    programLocations_.push_back(Detail::ProgramLocation{
+        &program, program.uniformLocation("viewProjection")});
+
+    return programLocations_.back().viewProjection;
+}
+
+} // namespace Render
@@ -0,0 +1,113 @@
+#ifndef MODELVIEWER_RENDER_GEOMETRYPOOL_HPP_
+#define MODELVIEWER_RENDER_GEOMETRYPOOL_HPP_
+
+#include "Model/MeshData.hpp"
+#include "OpenGL/OpenGLBufferObject.hpp"
+#include "OpenGL/OpenGLShaderProgram.hpp"
+#include "OpenGL/OpenGLTexture.hpp"
+#include "OpenGL/OpenGLVertexArrayObject.hpp"
+
+#include "glm/mat4x4.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace Render
+{
+
+/**
+ * \brief This class stores the geometry of many meshes in a few large buffers
+ * and draws them with \c glMultiDrawElementsIndirect.
+ *
+ * \details Meshes are suballocated out of pages. Every page is one vertex
+ * buffer and one element buffer sharing the Model::Vertex layout, with its
+ * own vertex array. The first page is small and every new page doubles, up
+ * to 1M vertices and 4M indices. A mesh larger than a page gets a page of its
+ * own.
+ *
+ * The draws of a frame are grouped by program, texture and page, and each
+ * group is submitted with a single \c glMultiDrawElementsIndirect. The model
+ * matrix of every draw is read from an instance buffer at the attributes 3 to
+ * 6, which the base instance of each draw command selects. Programs must read
+ * them like Shader/InstancedVertexShader.vs.glsl does.
+ *
+ * \par Warning:
+ * This class needs OpenGL 4.3 or \c ARB_multi_draw_indirect.
+ */
+class GeometryPool
+{
+public:
+    /**
+     * \brief Identify a mesh stored in the GeometryPool.
+     */
+    using Handle = size_t;
+
+    /**
+     * \brief Initializes a new instance of the GeometryPool class.
+     *
+     * \param pageVertexCount Number of vertices of the first page.
+     * \param pageIndexCount Number of indices of the first page.
+     */
+    explicit GeometryPool(size_t pageVertexCount = size_t{1} << 16,
+                          size_t pageIndexCount = size_t{1} << 18);
+
+    GeometryPool(GeometryPool &&other) noexcept;
+    GeometryPool &operator=(GeometryPool &&other) noexcept;
+    ~GeometryPool();
+
+    GeometryPool(const GeometryPool &other) = delete;
+    GeometryPool &operator=(const GeometryPool &other) = delete;
+
+    /**
+     * \brief Upload the vertices and indices of \p data into the pool.
+     *
+     * \param data Mesh to upload.
+     * \return Handle of the mesh.
+     */
+    Handle add(const Model::MeshData &data);
+
+    /**
+     * \brief Remove every draw since the last call.
+     */
+    void clearDraws();
+
+    /**
+     * \brief Queue a draw of \p mesh for the next execute.
+     *
+     * \param mesh Handle returned by add.
+     * \param model Model matrix of the draw.
+     * \param program Program to draw with.
+     * \param texture Texture bound to unit 0, or \c nullptr.
+     */
+    void draw(Handle mesh, const glm::mat4 &model,
+              OpenGL::OpenGLShaderProgram &program,
+              OpenGL::OpenGLTexture *texture);
+
+    /**
+     * \brief Submit the queued draws.
+     *
+     * \param view View matrix.
+     * \param projection Projection matrix.
+     */
+    void execute(const glm::mat4 &view, const glm::mat4 &projection);
+
+    size_t meshCount() const noexcept;
+    size_t pageCount() const noexcept;
+
+    size_t drawCount() const noexcept;
+
+    /**
+     * \brief Gets the number of \c glMultiDrawElementsIndirect calls of the
+     * last execute.
+     */
+    size_t batchCount() const noexcept;
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> pimpl_;
+};
+
+} // namespace Render
+
+#endif // MODELVIEWER_RENDER_GEOMETRYPOOL_HPP_
@@ -0,0 +1,316 @@
+#include "GpuProfiler.hpp"
+
+#include "OpenGL/OpenGLLib.hpp"
+#include "Utils/PreDefine.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace Render
+{
+
+namespace Detail
+{
+
+namespace Constant
+{
+
+constexpr size_t invalidScope{std::numeric_limits<size_t>::max()};
+
+// Bounds the queries of a frame when every draw has a scope.
+constexpr size_t maxScopeCount{4096};
+
+constexpr double millisecondsPerNanosecond{1.0e-6};
+
+} // namespace Constant
+
+struct Record
+{
+    const char *name;
+    size_t depth;
+    bool ended;
+};
+
+// Scope i of a frame writes the queries 2i and 2i + 1.
+struct Frame
+{
+    std::vector<GLuint> queries;
+    std::vector<Record> records;
+    GLuint lastQuery;
+};
+
+} // namespace Detail
+
+class GpuProfiler::Impl
+{
+public:
+    explicit Impl(size_t latency);
+    ~Impl();
+
+    Impl(Impl &&other) noexcept = delete;
+    Impl &operator=(Impl &&other) noexcept = delete;
+    Impl(const Impl &other) = delete;
+    Impl &operator=(const Impl &other) = delete;
+
+    bool beginFrame();
+    void endFrame();
+
+    size_t begin(const char *name);
+    void end(size_t scope);
+
+    const std::vector<Result> &results() const noexcept;
+    double frameTime() const noexcept;
+    size_t droppedFrameCount() const noexcept;
+
+    void setEnabled(bool enabled) noexcept;
+    bool isEnabled() const noexcept;
+
+private:
+    bool resolve(Detail::Frame &frame);
+
+    std::vector<Detail::Frame> frames_;
+    size_t current_;
+    size_t depth_;
+    bool inFrame_;
+    bool enabled_;
+
+    std::vector<Result> results_;
+    std::vector<size_t> lastAtDepth_;
+    double frameTime_;
+    size_t droppedFrameCount_;
+};
+
+GpuProfiler::GpuProfiler(size_t latency)
+    : pimpl_{std::make_unique<Impl>(latency)}
+{
+}
+
+GpuProfiler::GpuProfiler(GpuProfiler &&other) noexcept = default;
+
+GpuProfiler &GpuProfiler::operator=(GpuProfiler &&other) noexcept = default;
+
+GpuProfiler::~GpuProfiler() = default;
+
+size_t GpuProfiler::begin(const char *name) { return pimpl_->begin(name); }
+
+bool GpuProfiler::beginFrame() { return pimpl_->beginFrame(); }
+
+size_t GpuProfiler::droppedFrameCount() const noexcept
+{
+    return pimpl_->droppedFrameCount();
+}
+
+void GpuProfiler::end(size_t scope) { pimpl_->end(scope); }
+
+void GpuProfiler::endFrame() { pimpl_->endFrame(); }
+
+double GpuProfiler::frameTime() const noexcept { return pimpl_->frameTime(); }
+
+bool GpuProfiler::isEnabled() const noexcept { return pimpl_->isEnabled(); }
+
+const std::vector<GpuProfiler::Result> &GpuProfiler::results() const noexcept
+{
+    return pimpl_->results();
+}
+
+void GpuProfiler::setEnabled(bool enabled) noexcept
+{
+    pimpl_->setEnabled(enabled);
+}
+
+GpuProfiler::Impl::Impl(size_t latency)
+    : frames_(std::max(latency, size_t{1})), current_{0}, depth_{0},
+      inFrame_{false}, enabled_{true}, results_{}, lastAtDepth_{},
+      frameTime_{0.0}, droppedFrameCount_{0}
+{
+}
+
+GpuProfiler::Impl::~Impl()
+{
+    for (auto &frame : frames_)
+    {
+        if (!frame.queries.empty())
+        {
+            glDeleteQueries(static_cast<GLsizei>(frame.queries.size()),
+                            frame.queries.data());
+        }
+    }
+}
+
+size_t GpuProfiler::Impl::begin(const char *name)
+{
+    auto &frame{frames_[current_]};
+    if (!enabled_ || !inFrame_ ||
+        frame.records.size() >= Detail::Constant::maxScopeCount)
+    {
+        return Detail::Constant::invalidScope;
+    }
+
+    const auto scope{frame.records.size()};
+    if (frame.queries.size() < 2 * (scope + 1))
+    {
+        const auto oldSize{frame.queries.size()};
+        const auto newSize{std::min(std::max(oldSize * 2, size_t{64}),
+                                    2 * Detail::Constant::maxScopeCount)};
+        frame.queries.resize(newSize);
+        glGenQueries(static_cast<GLsizei>(newSize - oldSize),
+                     frame.queries.data() + oldSize);
+    }
+
+    frame.lastQuery = frame.queries[2 * scope];
+    glQueryCounter(frame.lastQuery, GL_TIMESTAMP);
+    frame.records.push_back(Detail::Record{name, depth_, false});
+    ++depth_;
+
+    return scope;
+}
+
+bool GpuProfiler::Impl::beginFrame()
+{
+    if (!enabled_)
+    {
+        return false;
+    }
+
+    // The oldest frame in flight is the one issued latency frames ago.
+    current_ = (current_ + 1) % frames_.size();
+    auto &frame{frames_[current_]};
+
+    auto resolved{false};
+    if (!frame.records.empty())
+    {
+        resolved = resolve(frame);
+        if (!resolved)
+        {
+            ++droppedFrameCount_;
+        }
+        frame.records.clear();
+    }
+
+    depth_ = 0;
+    inFrame_ = true;
+
+    return resolved;
+}
+
+size_t GpuProfiler::Impl::droppedFrameCount() const noexcept
+{
+    return droppedFrameCount_;
+}
+
+void GpuProfiler::Impl::end(size_t scope)
+{
+    auto &frame{frames_[current_]};
+    if (scope >= frame.records.size())
+    {
+        return;
+    }
+
+    PROGRAM_ASSERT(!frame.records[scope].ended);
+
+    frame.lastQuery = frame.queries[2 * scope + 1];
+    glQueryCounter(frame.lastQuery, GL_TIMESTAMP);
+    frame.records[scope].ended = true;
+    --depth_;
+}
+
+void GpuProfiler::Impl::endFrame() { inFrame_ = false; }
+
+double GpuProfiler::Impl::frameTime() const noexcept { return frameTime_; }
+
+bool GpuProfiler::Impl::isEnabled() const noexcept { return enabled_; }
+
+bool GpuProfiler::Impl::resolve(Detail::Frame &frame)
+{
+    // Queries complete in order, so the last one tells for the whole frame.
+    GLint available{GL_FALSE};
+    glGetQueryObjectiv(frame.lastQuery, GL_QUERY_RESULT_AVAILABLE, &available);
+    if (available == GL_FALSE)
+    {
+        return false;
+    }
+
+    results_.clear();
+    lastAtDepth_.clear();
+    frameTime_ = 0.0;
+
+    for (size_t i{0}; i < frame.records.size(); ++i)
+    {
+        const auto &record{frame.records[i]};
+        if (!record.ended)
+        {
+            continue;
+        }
+
+        GLuint64 begin;
+        GLuint64 end;
+        glGetQueryObjectui64v(frame.queries[2 * i], GL_QUERY_RESULT, &begin);
+        glGetQueryObjectui64v(frame.queries[2 * i + 1], GL_QUERY_RESULT, &end);
+        const auto milliseconds{static_cast<double>(end - begin) *
+                                Detail::Constant::millisecondsPerNanosecond};
+
+        if (record.depth == 0)
+        {
+            frameTime_ += milliseconds;
+        }
+
+        // A scope only merges into the previous sibling, which is the last
+        // result at its depth unless a shallower scope came in between.
+        lastAtDepth_.resize(record.depth + 1, Detail::Constant::invalidScope);
+        auto &sibling{lastAtDepth_[record.depth]};
+        if (sibling != Detail::Constant::invalidScope &&
+            std::strcmp(results_[sibling].name, record.name) == 0)
+        {
+            results_[sibling].milliseconds += milliseconds;
+            ++results_[sibling].count;
+            continue;
+        }
+
+        sibling = results_.size();
+        results_.push_back(
+            Result{record.name, record.depth, milliseconds, size_t{1}});
+    }
+
+    return true;
+}
+
+const std::vector<GpuProfiler::Result> &
+GpuProfiler::Impl::results() const noexcept
+{
+    return results_;
+}
+
+void GpuProfiler::Impl::setEnabled(bool enabled) noexcept
+{
+    if (enabled == enabled_)
+    {
+        return;
+    }
+
+    // Frames issued before disabling would be read back as if they were new.
+    for (auto &frame : frames_)
+    {
+        frame.records.clear();
+    }
+    results_.clear();
+    frameTime_ = 0.0;
+    inFrame_ = false;
+    enabled_ = enabled;
+}
+
+GpuScope::GpuScope(GpuProfiler *profiler, const char *name)
+    : profiler_{profiler}, scope_{profiler ? profiler->begin(name)
+                                           : Detail::Constant::invalidScope}
+{
+}
+
+GpuScope::~GpuScope()
+{
+    if (profiler_)
+    {
+        profiler_->end(scope_);
+    }
+}
+
+} // namespace Render
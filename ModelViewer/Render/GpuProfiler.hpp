@@ -0,0 +1,131 @@
+#ifndef MODELVIEWER_RENDER_GPUPROFILER_HPP_
+#define MODELVIEWER_RENDER_GPUPROFILER_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace Render
+{
+
+/**
+ * \brief This class measures the GPU time of named scopes of a frame with
+ * \c GL_TIMESTAMP queries.
+ *
+ * \details Every scope writes a timestamp when it begins and when it ends, so
+ * scopes may nest. The queries of a frame are read back \c latency frames
+ * later, when the GPU has normally finished them. If they are still not
+ * available the frame is dropped instead of waiting, so profiling never
+ * stalls the pipeline.
+ *
+ * Sibling scopes of the same name, e.g. one scope per draw, are merged into
+ * one result.
+ *
+ * \par Warning:
+ * This class needs OpenGL 3.3 or \c ARB_timer_query. Scope names must outlive
+ * the profiler, use string literals.
+ */
+class GpuProfiler
+{
+public:
+    /**
+     * \brief This struct represents the GPU time of one scope of a frame.
+     */
+    struct Result
+    {
+        const char *name;
+
+        /**
+         * \brief Number of enclosing scopes.
+         */
+        size_t depth;
+
+        double milliseconds;
+
+        /**
+         * \brief Number of merged sibling scopes.
+         */
+        size_t count;
+    };
+
+    /**
+     * \brief Initializes a new instance of the GpuProfiler class.
+     *
+     * \param latency Number of frames between issuing and reading back the
+     * queries of a frame.
+     */
+    explicit GpuProfiler(size_t latency = 4);
+
+    GpuProfiler(GpuProfiler &&other) noexcept;
+    GpuProfiler &operator=(GpuProfiler &&other) noexcept;
+    ~GpuProfiler();
+
+    GpuProfiler(const GpuProfiler &other) = delete;
+    GpuProfiler &operator=(const GpuProfiler &other) = delete;
+
+    /**
+     * \brief Start a new frame, and read back the oldest frame in flight.
+     *
+     * \return Return \c true if results holds a newly read frame. Otherwise,
+     * return \c false.
+     */
+    bool beginFrame();
+
+    void endFrame();
+
+    /**
+     * \brief Begin a scope named \p name.
+     *
+     * \return Id of the scope, to pass to end.
+     */
+    size_t begin(const char *name);
+
+    void end(size_t scope);
+
+    /**
+     * \brief Gets the scopes of the last frame read back, in begin order.
+     */
+    const std::vector<Result> &results() const noexcept;
+
+    /**
+     * \brief Gets the sum of the outermost scopes of the last frame read back.
+     */
+    double frameTime() const noexcept;
+
+    /**
+     * \brief Gets the number of frames whose queries were not available in
+     * time.
+     */
+    size_t droppedFrameCount() const noexcept;
+
+    void setEnabled(bool enabled) noexcept;
+    bool isEnabled() const noexcept;
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> pimpl_;
+};
+
+/**
+ * \brief This class begins a GpuProfiler scope on construction and ends it on
+ * destruction. A \c nullptr profiler makes it a no-op.
+ */
+class GpuScope
+{
+public:
+    explicit GpuScope(GpuProfiler *profiler, const char *name);
+    ~GpuScope();
+
+    GpuScope(const GpuScope &other) = delete;
+    GpuScope(GpuScope &&other) = delete;
+    GpuScope &operator=(const GpuScope &other) = delete;
+    GpuScope &operator=(GpuScope &&other) = delete;
+
+private:
+    GpuProfiler *profiler_;
+    size_t scope_;
+};
+
+} // namespace Render
+
+#endif // MODELVIEWER_RENDER_GPUPROFILER_HPP_
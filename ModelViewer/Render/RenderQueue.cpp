@@ -0,0 +1,192 @@
+#include "RenderQueue.hpp"
+
+#include "GpuProfiler.hpp"
+#include "OpenGL/OpenGLStateCache.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+namespace Render
+{
+
+namespace Detail
+{
+
+namespace Constant
+{
+
+constexpr int radixBits{8};
+constexpr size_t radixSize{size_t{1} << radixBits};
+constexpr int keyBits{64};
+
+// Opaque:      layer(1) | program(14) | texture(14) | depth(20) | array(15)
+// Translucent: layer(1) | inverse depth(20) | program(14) | texture(14) |
+//              array(15)
+constexpr int arrayBits{15};
+constexpr int textureBits{14};
+constexpr int programBits{14};
+constexpr int depthBits{20};
+
+constexpr uint64_t translucentLayer{uint64_t{1} << 63};
+
+} // namespace Constant
+
+uint64_t field(GLuint id, int bits) noexcept;
+uint64_t depthField(float depth) noexcept;
+
+uint64_t field(GLuint id, int bits) noexcept
+{
+    // Ids beyond the field only weaken the grouping, never the drawing.
+    return static_cast<uint64_t>(id) & ((uint64_t{1} << bits) - 1);
+}
+
+uint64_t depthField(float depth) noexcept
+{
+    // The bits of a non negative float sort the same as its value, keep the
+    // exponent and the top of the mantissa.
+    depth = std::max(depth, 0.0f);
+
+    uint32_t bits;
+    std::memcpy(&bits, &depth, sizeof(bits));
+
+    return field(bits >> (31 - Constant::depthBits), Constant::depthBits);
+}
+
+} // namespace Detail
+
+RenderQueue::RenderQueue()
+    : packets_{}, entries_{}, scratch_{}, programChangeCount_{0},
+      textureChangeCount_{0}
+{
+}
+
+void RenderQueue::clear()
+{
+    packets_.clear();
+    entries_.clear();
+}
+
+void RenderQueue::submit(const DrawPacket &packet)
+{
+    entries_.push_back(
+        Entry{sortKey(packet), static_cast<uint32_t>(packets_.size())});
+    packets_.push_back(packet);
+}
+
+void RenderQueue::sort()
+{
+    // LSD radix sort, skipping every digit all the keys agree on.
+    scratch_.resize(entries_.size());
+
+    for (int shift{0}; shift < Detail::Constant::keyBits;
+         shift += Detail::Constant::radixBits)
+    {
+        std::array<size_t, Detail::Constant::radixSize> count{};
+        for (const auto &entry : entries_)
+        {
+            ++count[(entry.key >> shift) & (Detail::Constant::radixSize - 1)];
+        }
+
+        if (std::any_of(count.cbegin(), count.cend(), [this](size_t x) {
+                return x == entries_.size();
+            }))
+        {
+            continue;
+        }
+
+        size_t offset{0};
+        for (auto &x : count)
+        {
+            const auto bucket{x};
+            x = offset;
+            offset += bucket;
+        }
+
+        for (const auto &entry : entries_)
+        {
+            scratch_[count[(entry.key >> shift) &
+                           (Detail::Constant::radixSize - 1)]++] = entry;
+        }
+
+        entries_.swap(scratch_);
+    }
+}
+
+void RenderQueue::execute(const glm::mat4 &view, const glm::mat4 &projection,
+                          GpuProfiler *profiler)
+{
+    const glm::mat4 viewProjection{projection * view};
+
+    OpenGL::OpenGLShaderProgram *program{nullptr};
+    OpenGL::OpenGLTexture *texture{nullptr};
+
+    programChangeCount_ = 0;
+    textureChangeCount_ = 0;
+
+    for (const auto &entry : entries_)
+    {
+        const auto &packet{packets_[entry.index]};
+
+        if (packet.program != program)
+        {
+            program = packet.program;
+            program->use();
+            ++programChangeCount_;
+        }
+
+        if (packet.texture && packet.texture != texture)
+        {
+            texture = packet.texture;
+            OpenGL::OpenGLStateCache::current().activeTexture(GL_TEXTURE0);
+            texture->bind();
+            ++textureChangeCount_;
+        }
+
+        const glm::mat4 mvp{viewProjection * packet.model};
+        program->setValue<4, 4>(packet.mvpLocation, mvp, false);
+
+        packet.vertexArray->bind();
+
+        GpuScope scope{profiler, "Draw"};
+        glDrawElements(GL_TRIANGLES, packet.indexCount, GL_UNSIGNED_INT, 0);
+    }
+}
+
+size_t RenderQueue::packetCount() const noexcept { return packets_.size(); }
+
+size_t RenderQueue::programChangeCount() const noexcept
+{
+    return programChangeCount_;
+}
+
+size_t RenderQueue::textureChangeCount() const noexcept
+{
+    return textureChangeCount_;
+}
+
+uint64_t RenderQueue::sortKey(const DrawPacket &packet) noexcept
+{
+    using namespace Detail::Constant;
+
+    const auto program{Detail::field(packet.program->id(), programBits)};
+    const auto texture{
+        packet.texture ? Detail::field(packet.texture->id(), textureBits) : 0};
+    const auto array{Detail::field(packet.vertexArray->id(), arrayBits)};
+    const auto depth{Detail::depthField(packet.depth)};
+
+    if (packet.translucent)
+    {
+        const uint64_t inverseDepth{((uint64_t{1} << depthBits) - 1) - depth};
+
+        return translucentLayer |
+               (inverseDepth << (programBits + textureBits + arrayBits)) |
+               (program << (textureBits + arrayBits)) |
+               (texture << arrayBits) | array;
+    }
+
+    return (program << (textureBits + depthBits + arrayBits)) |
+           (texture << (depthBits + arrayBits)) | (depth << arrayBits) | array;
+}
+
+} // namespace Render
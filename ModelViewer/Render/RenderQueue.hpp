@@ -0,0 +1,116 @@
+#ifndef MODELVIEWER_RENDER_RENDERQUEUE_HPP_
+#define MODELVIEWER_RENDER_RENDERQUEUE_HPP_
+
+#include "OpenGL/OpenGLShaderProgram.hpp"
+#include "OpenGL/OpenGLTexture.hpp"
+#include "OpenGL/OpenGLVertexArrayObject.hpp"
+
+#include "glm/mat4x4.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Render
+{
+
+class GpuProfiler;
+
+/**
+ * \brief This struct represents everything needed to issue one draw call.
+ *
+ * \details The vertex array must have an element array buffer of
+ * \c unsigned \c int indices bound to it.
+ */
+struct DrawPacket
+{
+    OpenGL::OpenGLShaderProgram *program;
+    OpenGL::UniformLocation mvpLocation;
+    OpenGL::OpenGLTexture *texture;
+    OpenGL::OpenGLVertexArrayObject *vertexArray;
+    GLsizei indexCount;
+
+    glm::mat4 model;
+
+    /**
+     * \brief View space distance to the camera, used for the draw order.
+     */
+    float depth;
+
+    /**
+     * \brief Translucent packets are drawn after the opaque ones, from back to
+     * front.
+     */
+    bool translucent;
+};
+
+/**
+ * \brief This class collects the draw packets of a frame and draws them in an
+ * order which minimizes the state changes.
+ *
+ * \details Every packet gets a 64 bit sort key. Opaque packets are grouped by
+ * program, then by texture, and drawn front to back inside a group so early
+ * depth testing rejects hidden fragments. Translucent packets follow, from
+ * back to front. The keys are sorted with a radix sort, so sorting stays
+ * linear in the packet count.
+ */
+class RenderQueue
+{
+public:
+    explicit RenderQueue();
+
+    /**
+     * \brief Remove every packet submitted since the last call.
+     */
+    void clear();
+
+    void submit(const DrawPacket &packet);
+
+    /**
+     * \brief Sort the submitted packets by their sort keys.
+     */
+    void sort();
+
+    /**
+     * \brief Draw the packets in sorted order.
+     *
+     * \param view View matrix.
+     * \param projection Projection matrix.
+     * \param profiler If not \c nullptr, every draw is measured in a "Draw"
+     * scope of it.
+     */
+    void execute(const glm::mat4 &view, const glm::mat4 &projection,
+                 GpuProfiler *profiler = nullptr);
+
+    size_t packetCount() const noexcept;
+
+    /**
+     * \brief Gets the number of program changes of the last execute.
+     */
+    size_t programChangeCount() const noexcept;
+
+    /**
+     * \brief Gets the number of texture changes of the last execute.
+     */
+    size_t textureChangeCount() const noexcept;
+
+    static uint64_t sortKey(const DrawPacket &packet) noexcept;
+
+private:
+    struct Entry
+    {
+        uint64_t key;
+        uint32_t index;
+    };
+
+    std::vector<DrawPacket> packets_;
+    std::vector<Entry> entries_;
+    std::vector<Entry> scratch_;
+
+    size_t programChangeCount_;
+    size_t textureChangeCount_;
+};
+
+} // namespace Render
+
+#endif // MODELVIEWER_RENDER_RENDERQUEUE_HPP_
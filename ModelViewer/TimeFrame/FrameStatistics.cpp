@@ -0,0 +1,179 @@
+#include "FrameStatistics.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace TimeFrame
+{
+
+namespace Detail
+{
+
+namespace Constant
+{
+
+constexpr size_t bucketCount{32};
+constexpr double defaultBucketWidth{0.002};
+constexpr double defaultHitchThreshold{0.05};
+
+} // namespace Constant
+
+} // namespace Detail
+
+FrameStatistics::FrameStatistics(size_t capacity)
+    : ring_(std::max(capacity, size_t{1}), 0.0), head_{0}, count_{0},
+      totalCount_{0},
+      hitchThreshold_{Detail::Constant::defaultHitchThreshold},
+      hitchCount_{0}, bucketWidth_{Detail::Constant::defaultBucketWidth},
+      histogram_(Detail::Constant::bucketCount, 0), sorted_{}
+{
+}
+
+void FrameStatistics::addFrame(double seconds) noexcept
+{
+    if (count_ == ring_.size())
+    {
+        --histogram_[bucketOf(ring_[head_], bucketWidth_, histogram_.size())];
+    }
+    else
+    {
+        ++count_;
+    }
+
+    ring_[head_] = seconds;
+    head_ = (head_ + 1) % ring_.size();
+
+    ++histogram_[bucketOf(seconds, bucketWidth_, histogram_.size())];
+    ++totalCount_;
+
+    if (seconds > hitchThreshold_)
+    {
+        ++hitchCount_;
+    }
+}
+
+double FrameStatistics::bucketWidth() const noexcept { return bucketWidth_; }
+
+size_t FrameStatistics::capacity() const noexcept { return ring_.size(); }
+
+void FrameStatistics::clear() noexcept
+{
+    head_ = 0;
+    count_ = 0;
+    totalCount_ = 0;
+    hitchCount_ = 0;
+    std::fill(histogram_.begin(), histogram_.end(), size_t{0});
+}
+
+void FrameStatistics::durations(std::vector<float> &durations) const
+{
+    durations.clear();
+    durations.reserve(count_);
+
+    const auto oldest{(head_ + ring_.size() - count_) % ring_.size()};
+    for (size_t i{0}; i < count_; ++i)
+    {
+        durations.push_back(
+            static_cast<float>(ring_[(oldest + i) % ring_.size()]));
+    }
+}
+
+size_t FrameStatistics::frameCount() const noexcept { return count_; }
+
+const std::vector<size_t> &FrameStatistics::histogram() const noexcept
+{
+    return histogram_;
+}
+
+size_t FrameStatistics::hitchCount() const noexcept { return hitchCount_; }
+
+double FrameStatistics::hitchThreshold() const noexcept
+{
+    return hitchThreshold_;
+}
+
+void FrameStatistics::setBucketWidth(double seconds) noexcept
+{
+    if (!(seconds > 0.0))
+    {
+        return;
+    }
+
+    bucketWidth_ = seconds;
+
+    std::fill(histogram_.begin(), histogram_.end(), size_t{0});
+    const auto oldest{(head_ + ring_.size() - count_) % ring_.size()};
+    for (size_t i{0}; i < count_; ++i)
+    {
+        const auto frame{ring_[(oldest + i) % ring_.size()]};
+        ++histogram_[bucketOf(frame, bucketWidth_, histogram_.size())];
+    }
+}
+
+void FrameStatistics::setHitchThreshold(double seconds) noexcept
+{
+    hitchThreshold_ = seconds;
+}
+
+FrameSummary FrameStatistics::summary(size_t window) const
+{
+    window = std::min(window, count_);
+    if (window == 0)
+    {
+        return FrameSummary{0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+    }
+
+    sorted_.clear();
+    const auto newest{head_ + ring_.size()};
+    for (size_t i{1}; i <= window; ++i)
+    {
+        sorted_.push_back(ring_[(newest - i) % ring_.size()]);
+    }
+    std::sort(sorted_.begin(), sorted_.end());
+
+    const auto total{std::accumulate(sorted_.begin(), sorted_.end(), 0.0)};
+
+    return FrameSummary{window,
+                        sorted_.front(),
+                        sorted_.back(),
+                        total / static_cast<double>(window),
+                        percentile(sorted_, 50.0),
+                        percentile(sorted_, 95.0),
+                        percentile(sorted_, 99.0)};
+}
+
+size_t FrameStatistics::totalFrameCount() const noexcept
+{
+    return totalCount_;
+}
+
+size_t FrameStatistics::bucketOf(double seconds, double bucketWidth,
+                                 size_t bucketCount) noexcept
+{
+    const auto last{bucketCount - 1};
+    if (!(seconds > 0.0))
+    {
+        return 0;
+    }
+
+    const auto bucket{seconds / bucketWidth};
+    return bucket >= static_cast<double>(last) ? last
+                                               : static_cast<size_t>(bucket);
+}
+
+double FrameStatistics::percentile(const std::vector<double> &sorted,
+                                   double p) noexcept
+{
+    if (sorted.empty())
+    {
+        return 0.0;
+    }
+
+    auto rank{static_cast<size_t>(
+        std::ceil(p / 100.0 * static_cast<double>(sorted.size())))};
+
+    return sorted[std::min(std::max(rank, size_t{1}), sorted.size()) - 1];
+}
+
+} // namespace TimeFrame
@@ -0,0 +1,162 @@
+#ifndef MODELVIEWER_TIMEFRAME_FRAMESTATISTICS_HPP_
+#define MODELVIEWER_TIMEFRAME_FRAMESTATISTICS_HPP_
+
+#include <cstddef>
+#include <vector>
+
+namespace TimeFrame
+{
+
+/**
+ * \brief This struct represents the distribution of the frame times in a
+ * window of recent frames. Every value is in seconds.
+ */
+struct FrameSummary
+{
+    size_t frames;
+    double min;
+    double max;
+    double mean;
+    double p50;
+    double p95;
+    double p99;
+};
+
+/**
+ * \brief This class keeps the durations of the recent frames.
+ *
+ * \details The durations are kept in a ring of fixed capacity, the oldest
+ * frame is dropped when a new one is added. Adding a frame is O(1): the ring,
+ * the histogram and the hitch counter are updated in place.
+ * A summary sorts a copy of the requested window, so its cost depends on the
+ * window, not on how many frames were added.
+ *
+ * A hitch is a frame longer than the hitch threshold. Unlike the ring, the
+ * hitch counter is never trimmed, it counts every frame since the last clear.
+ */
+class FrameStatistics
+{
+public:
+    /**
+     * \brief Initializes a new instance of the FrameStatistics class.
+     *
+     * \param capacity How many recent frames are kept, at least 1.
+     */
+    explicit FrameStatistics(size_t capacity = 1024);
+
+    /**
+     * \brief Add the duration of a frame.
+     *
+     * \param seconds Specified duration in second.
+     */
+    void addFrame(double seconds) noexcept;
+
+    /**
+     * \brief Forget every frame and zero the hitch counter. The capacity,
+     * the threshold and the bucket width are kept.
+     */
+    void clear() noexcept;
+
+    /**
+     * \brief Gets the distribution of the recent frames.
+     *
+     * \param window How many of the most recent frames are summarized. It is
+     * clamped to the frames in the ring.
+     * \return Requested value. Every member is 0 if there is no frame.
+     */
+    FrameSummary summary(size_t window) const;
+
+    /**
+     * \brief Gets the durations in the ring from the oldest to the newest.
+     *
+     * \param durations Receives the durations in second.
+     */
+    void durations(std::vector<float> &durations) const;
+
+    /**
+     * \brief Sets the threshold of a hitch. Frames added before are not
+     * counted again.
+     *
+     * \param seconds Specified threshold in second.
+     */
+    void setHitchThreshold(double seconds) noexcept;
+    double hitchThreshold() const noexcept;
+
+    /**
+     * \brief Gets the number of hitches since the last clear.
+     */
+    size_t hitchCount() const noexcept;
+
+    /**
+     * \brief Sets the width of a histogram bucket and rebuilds the histogram
+     * from the ring.
+     *
+     * \param seconds Specified width in second, it must be positive.
+     */
+    void setBucketWidth(double seconds) noexcept;
+    double bucketWidth() const noexcept;
+
+    /**
+     * \brief Gets the histogram of the frames in the ring.
+     *
+     * \par
+     * Bucket \c i counts the frames in <tt>[i, i + 1) * bucketWidth</tt>, the
+     * last bucket also counts every longer frame.
+     *
+     * \return Requested value.
+     */
+    const std::vector<size_t> &histogram() const noexcept;
+
+    /**
+     * \brief Gets the number of frames in the ring.
+     */
+    size_t frameCount() const noexcept;
+
+    size_t capacity() const noexcept;
+
+    /**
+     * \brief Gets the number of frames added since the last clear.
+     */
+    size_t totalFrameCount() const noexcept;
+
+    /**
+     * \brief Gets the percentile of sorted durations, by nearest rank so the
+     * value is always one of the durations.
+     *
+     * \param sorted Durations in ascending order.
+     * \param p Specified percentile, from 0 to 100.
+     * \return Requested value. Return 0 if there is no duration.
+     */
+    static double percentile(const std::vector<double> &sorted,
+                             double p) noexcept;
+
+    /**
+     * \brief Gets the histogram bucket of a duration, the last bucket also
+     * counts every longer duration.
+     *
+     * \param seconds Specified duration in second.
+     * \param bucketWidth Width of a bucket in second.
+     * \param bucketCount Number of buckets, at least 1.
+     * \return Requested value.
+     */
+    static size_t bucketOf(double seconds, double bucketWidth,
+                           size_t bucketCount) noexcept;
+
+private:
+    std::vector<double> ring_;
+    size_t head_;
+    size_t count_;
+    size_t totalCount_;
+
+    double hitchThreshold_;
+    size_t hitchCount_;
+
+    double bucketWidth_;
+    std::vector<size_t> histogram_;
+
+    mutable std::vector<double> sorted_;
+};
+
+} // namespace TimeFrame
+
+#endif // MODELVIEWER_TIMEFRAME_FRAMESTATISTICS_HPP_
@@ -32,6 +32,7 @@ public:
 
     void start(uint64_t now);
     void update(uint64_t now);
+    void skip(uint64_t now);
     void stop();
 
     void reset();
@@ -47,6 +48,9 @@ public:
     void setTimeScale(double t) noexcept;
     double timeScale() const noexcept;
 
+    const FrameStatistics &statistics() const noexcept;
+    FrameStatistics &statistics() noexcept;
+
 private:
     double frequency_;
 
@@ -63,6 +67,8 @@ private:
 
     size_t frameCount_;
 
+    FrameStatistics statistics_;
+
     bool isActive_;
 };
 
@@ -99,8 +105,20 @@ void TimeFrame::reset() { pimpl_->reset(); }
 
 void TimeFrame::setTimeScale(double t) noexcept { pimpl_->setTimeScale(t); }
 
+void TimeFrame::skip(uint64_t now) { pimpl_->skip(now); }
+
 void TimeFrame::start(uint64_t now) { pimpl_->start(now); }
 
+const FrameStatistics &TimeFrame::statistics() const noexcept
+{
+    return pimpl_->statistics();
+}
+
+FrameStatistics &TimeFrame::statistics() noexcept
+{
+    return pimpl_->statistics();
+}
+
 void TimeFrame::stop() { pimpl_->stop(); }
 
 double TimeFrame::time() const noexcept { return pimpl_->time(); }
@@ -125,7 +143,7 @@ TimeFrame::Impl::Impl(uint64_t frequency)
     : frequency_{static_cast<double>(frequency)}, start_{0}, now_{0},
       timeScale_{Detail::Constant::normalTimeScale}, time_{0.0},
       unscaledTime_{0.0}, deltaTime_{0.0}, unscaledDeltaTime_{0.0},
-      frameCount_{0}, isActive_{false}
+      frameCount_{0}, statistics_{}, isActive_{false}
 {
 }
 
@@ -163,6 +181,17 @@ void TimeFrame::Impl::setTimeScale(double t) noexcept
     }
 }
 
+void TimeFrame::Impl::skip(uint64_t now)
+{
+    if (!isActive_)
+    {
+        throw TimeFrameException(
+            "skip is called when time frame is not running.");
+    }
+
+    now_ = now;
+}
+
 void TimeFrame::Impl::start(uint64_t now)
 {
     if (isActive_)
@@ -188,6 +217,13 @@ void TimeFrame::Impl::stop()
     isActive_ = false;
 }
 
+const FrameStatistics &TimeFrame::Impl::statistics() const noexcept
+{
+    return statistics_;
+}
+
+FrameStatistics &TimeFrame::Impl::statistics() noexcept { return statistics_; }
+
 double TimeFrame::Impl::time() const noexcept { return time_; }
 
 double TimeFrame::Impl::timeScale() const noexcept { return timeScale_; }
@@ -217,6 +253,8 @@ void TimeFrame::Impl::update(uint64_t now)
     time_ += deltaTime_;
 
     ++frameCount_;
+
+    statistics_.addFrame(unscaledDeltaTime_);
 }
 
 void TimeFrame::Impl::zero()
@@ -236,6 +274,8 @@ void TimeFrame::Impl::zero()
     unscaledDeltaTime_ = 0.0;
 
     frameCount_ = 0;
+
+    statistics_.clear();
 }
 
 } // namespace TimeFrame
@@ -1,6 +1,8 @@
 #ifndef MODELVIEWER_TIMEFRAME_TIMEFRAME_HPP_
 #define MODELVIEWER_TIMEFRAME_TIMEFRAME_HPP_
 
+#include "FrameStatistics.hpp"
+
 #include <memory>
 
 namespace TimeFrame
@@ -60,6 +62,20 @@ public:
      */
     void update(uint64_t now);
 
+    /**
+     * \brief Skip the time since the last update.
+     *
+     * This function moves the current frame to \p now without counting a
+     * frame, so neither the next deltaTime nor time includes the skipped
+     * time. Use it after the program waited idle. unscaledTime still
+     * includes it.
+     *
+     * \param now current time.
+     *
+     * \exception TimeFrameException TimeFrame is not running yet.
+     */
+    void skip(uint64_t now);
+
     /**
      * \brief stop the TimeFrame
      *
@@ -186,6 +202,16 @@ public:
      */
     double timeScale() const noexcept;
 
+    /**
+     * \brief The durations of the recent frames.
+     *
+     * Every update adds unscaledDeltaTime to the statistics. zero clears them.
+     *
+     * \return Requested value.
+     */
+    const FrameStatistics &statistics() const noexcept;
+    FrameStatistics &statistics() noexcept;
+
 private:
     class Impl;
     std::unique_ptr<Impl> pimpl_;
@@ -0,0 +1,62 @@
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+
+namespace Parallel
+{
+
+template <typename Function>
+void forEach(size_t jobCount, Function &&function)
+{
+    const size_t workerCount{
+        std::min(static_cast<size_t>(threadCount()), jobCount)};
+
+    if (workerCount <= 1)
+    {
+        for (size_t job{0}; job < jobCount; ++job)
+        {
+            function(job);
+        }
+        return;
+    }
+
+    std::atomic<size_t> nextJob{0};
+    std::exception_ptr exception;
+    std::mutex exceptionMutex;
+
+    auto worker{[&]() {
+        try
+        {
+            for (size_t job{nextJob++}; job < jobCount; job = nextJob++)
+            {
+                function(job);
+            }
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(exceptionMutex);
+            if (!exception)
+            {
+                exception = std::current_exception();
+            }
+            nextJob = jobCount;
+        }
+    }};
+
+    auto task{[](void *context) {
+        (*static_cast<decltype(worker) *>(context))();
+    }};
+
+    if (!Detail::runOnPool(task, &worker, workerCount - 1))
+    {
+        worker();
+    }
+
+    if (exception)
+    {
+        std::rethrow_exception(exception);
+    }
+}
+
+} // namespace Parallel
@@ -0,0 +1,167 @@
+#include "Parallel.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Parallel
+{
+
+namespace Detail
+{
+
+// The workers sleep between the calls. A call publishes its task under the
+// mutex and bumps the generation; the first helperCount workers run it.
+class Pool
+{
+public:
+    explicit Pool(size_t workerCount);
+    ~Pool();
+
+    Pool(const Pool &other) = delete;
+    Pool(Pool &&other) = delete;
+    Pool &operator=(const Pool &other) = delete;
+    Pool &operator=(Pool &&other) = delete;
+
+    bool run(void (*task)(void *), void *context, size_t helperCount);
+
+private:
+    void workerLoop(size_t index);
+
+    std::atomic<bool> busy_;
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    void (*task_)(void *);
+    void *context_;
+    size_t helperCount_;
+    size_t running_;
+    size_t generation_;
+    bool stopping_;
+
+    std::vector<std::thread> threads_;
+};
+
+Pool &pool();
+
+Pool::Pool(size_t workerCount)
+    : busy_{false}, mutex_{}, wake_{}, done_{}, task_{nullptr},
+      context_{nullptr}, helperCount_{0}, running_{0}, generation_{0},
+      stopping_{false}, threads_{}
+{
+    threads_.reserve(workerCount);
+    for (size_t i{0}; i < workerCount; ++i)
+    {
+        threads_.emplace_back(&Pool::workerLoop, this, i);
+    }
+}
+
+Pool::~Pool()
+{
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        stopping_ = true;
+    }
+    wake_.notify_all();
+
+    for (auto &thread : threads_)
+    {
+        thread.join();
+    }
+}
+
+bool Pool::run(void (*task)(void *), void *context, size_t helperCount)
+{
+    // A flag rather than a mutex, a job may call forEach again on this
+    // thread.
+    if (busy_.exchange(true, std::memory_order_acquire))
+    {
+        return false;
+    }
+
+    helperCount = std::min(helperCount, threads_.size());
+    {
+        std::lock_guard<std::mutex> lock{mutex_};
+        task_ = task;
+        context_ = context;
+        helperCount_ = helperCount;
+        running_ = helperCount;
+        ++generation_;
+    }
+    wake_.notify_all();
+
+    task(context);
+
+    {
+        std::unique_lock<std::mutex> lock{mutex_};
+        done_.wait(lock, [this]() { return running_ == 0; });
+    }
+
+    busy_.store(false, std::memory_order_release);
+
+    return true;
+}
+
+void Pool::workerLoop(size_t index)
+{
+    size_t seen{0};
+
+    std::unique_lock<std::mutex> lock{mutex_};
+    for (;;)
+    {
+        wake_.wait(lock, [this, &seen]() {
+            return stopping_ || generation_ != seen;
+        });
+        if (stopping_)
+        {
+            return;
+        }
+
+        seen = generation_;
+        if (index >= helperCount_)
+        {
+            continue;
+        }
+
+        // The call waits for this worker, so the task stays valid.
+        auto task{task_};
+        auto context{context_};
+
+        lock.unlock();
+        task(context);
+        lock.lock();
+
+        if (--running_ == 0)
+        {
+            done_.notify_one();
+        }
+    }
+}
+
+Pool &pool()
+{
+    static Pool instance{threadCount() - 1};
+
+    return instance;
+}
+
+bool runOnPool(void (*task)(void *), void *context, size_t helperCount)
+{
+    return pool().run(task, context, helperCount);
+}
+
+} // namespace Detail
+
+unsigned int threadCount() noexcept
+{
+    static const unsigned int count{std::max(
+        std::thread::hardware_concurrency(), static_cast<unsigned int>(1))};
+
+    return count;
+}
+
+} // namespace Parallel
@@ -0,0 +1,56 @@
+#ifndef MODELVIEWER_UTILS_PARALLEL_PARALLEL_HPP_
+#define MODELVIEWER_UTILS_PARALLEL_PARALLEL_HPP_
+
+#include <cstddef>
+
+namespace Parallel
+{
+
+/**
+ * @brief Number of worker threads used by the parallel algorithms.
+ * @details
+ *     Equal to std::thread::hardware_concurrency. Return 1 if the value is
+ *     not computable.
+ *
+ * @return Requested thread count
+ */
+unsigned int threadCount() noexcept;
+
+/**
+ * @brief Run \p function for every job in [0, \p jobCount) on all cores.
+ * @details
+ *     Jobs are handed out through an atomic counter, so the jobs may finish
+ *     in any order. The calling thread takes part in the work and the function
+ *     returns once every job is done. The first exception thrown by any job is
+ *     rethrown to the caller.
+ *
+ *     The other threads come from a pool created by the first call and kept
+ *     until exit. The pool runs one call at a time: a call made while it is
+ *     busy, from another thread or from inside a job, runs its jobs on the
+ *     calling thread only.
+ *
+ * @tparam Function Callable with signature void(size_t job)
+ * @param jobCount Number of jobs
+ * @param function Job function
+ */
+template <typename Function>
+void forEach(size_t jobCount, Function &&function);
+
+namespace Detail
+{
+
+/**
+ * @brief Run \p task on the calling thread and on \p helperCount threads of
+ * the pool, and wait for all of them.
+ *
+ * @return false if the pool is busy, \p task was not run.
+ */
+bool runOnPool(void (*task)(void *), void *context, size_t helperCount);
+
+} // namespace Detail
+
+} // namespace Parallel
+
+#include "Parallel-inl.hpp"
+
+#endif // MODELVIEWER_UTILS_PARALLEL_PARALLEL_HPP_
@@ -0,0 +1,241 @@
+#include "Event/ConcurrentEventQueue.hpp"
+#include "Event/KeyboardEvent.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <new>
+#include <thread>
+
+// Several producers push into one small queue while the main thread drains
+// it. Every producer numbers its events, so the consumer can check that each
+// producer's events come out in order and that none is lost or duplicated.
+
+namespace Detail
+{
+
+namespace Constant
+{
+
+constexpr size_t capacity{256};
+constexpr size_t producerCount{4};
+constexpr size_t eventsPerProducer{200000};
+constexpr size_t overflowCount{16};
+
+} // namespace Constant
+
+// Only the threads measuring the steady state count their allocations.
+std::atomic<size_t> allocationCount{0};
+thread_local bool isMeasured{false};
+
+struct Producer
+{
+    size_t pushed;
+    size_t dropped;
+};
+
+bool check(bool condition, const char *what);
+Event::KeyboardEvent makeEvent(size_t producer, size_t sequence);
+void produce(Event::ConcurrentEventQueue &queue, size_t producer,
+             Producer &result, std::atomic<size_t> &finished);
+bool testFull();
+
+bool check(bool condition, const char *what)
+{
+    if (!condition)
+    {
+        std::fprintf(stderr, "Failed: %s\n", what);
+    }
+
+    return condition;
+}
+
+// The scan code tells the producer and the timestamp the sequence.
+Event::KeyboardEvent makeEvent(size_t producer, size_t sequence)
+{
+    return Event::KeyboardEvent{65, 1, static_cast<int>(producer),
+                                static_cast<Event::Event::TimeType>(sequence),
+                                nullptr};
+}
+
+void produce(Event::ConcurrentEventQueue &queue, size_t producer,
+             Producer &result, std::atomic<size_t> &finished)
+{
+    isMeasured = true;
+
+    for (size_t i{0}; i < Constant::eventsPerProducer; ++i)
+    {
+        if (queue.push(makeEvent(producer, i + 1)))
+        {
+            ++result.pushed;
+        }
+        else
+        {
+            // Let the consumer catch up, the queue still overflows often.
+            ++result.dropped;
+            std::this_thread::yield();
+        }
+    }
+
+    isMeasured = false;
+    finished.fetch_add(1, std::memory_order_release);
+}
+
+// One thread fills the queue, every push past the capacity is dropped.
+bool testFull()
+{
+    Event::ConcurrentEventQueue queue{Constant::capacity};
+
+    size_t accepted{0};
+    for (size_t i{0}; i < Constant::capacity + Constant::overflowCount; ++i)
+    {
+        accepted += queue.push(makeEvent(0, i + 1)) ? 1 : 0;
+    }
+
+    size_t drained{0};
+    while (queue.front())
+    {
+        queue.pop();
+        ++drained;
+    }
+
+    auto passed{true};
+    passed &= check(accepted == Constant::capacity,
+                    "a full queue accepts its capacity");
+    passed &= check(queue.droppedCount() == Constant::overflowCount,
+                    "every push past the capacity is dropped");
+    passed &= check(drained == Constant::capacity,
+                    "every accepted event is drained");
+    passed &= check(queue.empty(), "the queue is empty after the drain");
+
+    return passed;
+}
+
+} // namespace Detail
+
+void *operator new(size_t size)
+{
+    if (Detail::isMeasured)
+    {
+        Detail::allocationCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    if (auto memory{std::malloc(size ? size : 1)})
+    {
+        return memory;
+    }
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void *memory) noexcept { std::free(memory); }
+
+void operator delete(void *memory, size_t) noexcept { std::free(memory); }
+
+int main()
+{
+    using Detail::Constant::producerCount;
+
+    auto passed{Detail::testFull()};
+
+    Event::ConcurrentEventQueue queue{Detail::Constant::capacity};
+
+    // Warm up: a full lap through every slot before the threads start.
+    for (size_t i{0}; i < queue.capacity(); ++i)
+    {
+        queue.push(Detail::makeEvent(0, 0));
+    }
+    while (queue.front())
+    {
+        queue.pop();
+    }
+    const auto warmDropped{queue.droppedCount()};
+
+    std::array<Detail::Producer, producerCount> producers{};
+    std::array<size_t, producerCount> lastSequence{};
+    std::atomic<size_t> finished{0};
+
+    std::array<std::thread, producerCount> threads;
+    for (size_t i{0}; i < producerCount; ++i)
+    {
+        threads[i] = std::thread{Detail::produce, std::ref(queue), i,
+                                 std::ref(producers[i]), std::ref(finished)};
+    }
+
+    size_t received{0};
+    auto ordered{true};
+    auto known{true};
+
+    Detail::isMeasured = true;
+    for (;;)
+    {
+        // Read before front, so an empty queue after the last producer
+        // finished is really empty.
+        const auto done{finished.load(std::memory_order_acquire) ==
+                        producerCount};
+
+        auto event{queue.front()};
+        if (!event)
+        {
+            if (done)
+            {
+                break;
+            }
+            std::this_thread::yield();
+            continue;
+        }
+
+        auto keyboard{event->type() == Event::Type::Keyboard
+                          ? static_cast<Event::KeyboardEvent *>(event)
+                          : nullptr};
+        const auto producer{
+            keyboard ? static_cast<size_t>(keyboard->scanCode()) : 0};
+        if (!keyboard || producer >= producerCount)
+        {
+            known = false;
+        }
+        else
+        {
+            ordered = ordered && event->timestamp() > lastSequence[producer];
+            lastSequence[producer] = event->timestamp();
+        }
+
+        queue.pop();
+        ++received;
+    }
+    Detail::isMeasured = false;
+
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+
+    size_t pushed{0};
+    size_t dropped{0};
+    for (const auto &producer : producers)
+    {
+        pushed += producer.pushed;
+        dropped += producer.dropped;
+    }
+
+    const auto allocations{Detail::allocationCount.load()};
+
+    passed &= Detail::check(known, "every event comes from a producer");
+    passed &= Detail::check(ordered, "every producer's events stay in order");
+    passed &= Detail::check(received == pushed,
+                            "every accepted event is received once");
+    passed &= Detail::check(queue.droppedCount() - warmDropped == dropped,
+                            "every rejected push is counted as dropped");
+    passed &= Detail::check(pushed + dropped ==
+                                producerCount *
+                                    Detail::Constant::eventsPerProducer,
+                            "every push is accepted or dropped");
+    passed &= Detail::check(allocations == 0, "no allocation after warm up");
+
+    std::printf("%zu received, %zu dropped, %zu allocations\n", received,
+                dropped, allocations);
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
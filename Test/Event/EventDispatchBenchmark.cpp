@@ -0,0 +1,235 @@
+#include "Event/EventDispatcher.hpp"
+#include "Event/EventHandler.hpp"
+#include "Event/EventHandlerBase.hpp"
+#include "Event/KeyboardEvent.hpp"
+#include "Event/MouseEvent.hpp"
+#include "Event/MoveEvent.hpp"
+#include "Event/ResizeEvent.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <forward_list>
+#include <memory>
+#include <vector>
+
+// Times EventDispatcher against the chain it replaced: a list of handlers
+// where each one tries a dynamic_cast until one of them matches.
+
+namespace Detail
+{
+
+namespace Constant
+{
+
+constexpr size_t eventCount{1024};
+constexpr size_t defaultRepeatCount{2000};
+
+} // namespace Constant
+
+class Sink
+{
+public:
+    void move(Event::MoveEvent *event) { count(event); }
+    void windowResize(Event::WindowResizeEvent *event) { count(event); }
+    void frameBufferResize(Event::FrameBufferResizeEvent *event)
+    {
+        count(event);
+    }
+    void keyboard(Event::KeyboardEvent *event) { count(event); }
+    void mouse(Event::MouseEvent *event) { count(event); }
+
+    size_t handled{0};
+    uint64_t checksum{0};
+
+private:
+    void count(Event::Event *event)
+    {
+        ++handled;
+        checksum += event->timestamp();
+    }
+};
+
+// The handler before the dispatch table, which found its event by a cast.
+template <typename EventType, void (Sink::*respondFunction)(EventType *)>
+class CastHandler : public Event::EventHandlerBase
+{
+public:
+    explicit CastHandler(Sink &sink)
+        : Event::EventHandlerBase{EventType::staticType()}, sink_{&sink}
+    {
+    }
+
+    virtual bool handle(Event::Event *event) override
+    {
+        if (auto e{dynamic_cast<EventType *>(event)})
+        {
+            (sink_->*respondFunction)(e);
+            return true;
+        }
+        return false;
+    }
+
+private:
+    Sink *sink_;
+};
+
+using Chain = std::forward_list<std::unique_ptr<Event::EventHandlerBase>>;
+using Clock = std::chrono::steady_clock;
+
+void subscribe(Event::EventDispatcher &dispatcher, Sink &sink);
+void subscribe(Chain &chain, Sink &sink);
+std::vector<std::unique_ptr<Event::Event>> makeEvents();
+double nanosecondsPerEvent(Clock::duration elapsed, size_t events);
+
+void subscribe(Event::EventDispatcher &dispatcher, Sink &sink)
+{
+    dispatcher.subscribe(
+        std::make_unique<
+            Event::EventHandler<Sink, Event::MoveEvent, &Sink::move>>(sink));
+    dispatcher.subscribe(
+        std::make_unique<Event::EventHandler<Sink, Event::WindowResizeEvent,
+                                             &Sink::windowResize>>(sink));
+    dispatcher.subscribe(
+        std::make_unique<Event::EventHandler<
+            Sink, Event::FrameBufferResizeEvent, &Sink::frameBufferResize>>(
+            sink));
+    dispatcher.subscribe(
+        std::make_unique<
+            Event::EventHandler<Sink, Event::KeyboardEvent, &Sink::keyboard>>(
+            sink));
+    dispatcher.subscribe(
+        std::make_unique<
+            Event::EventHandler<Sink, Event::MouseEvent, &Sink::mouse>>(sink));
+}
+
+// Same order as the window used, every handler was pushed to the front.
+void subscribe(Chain &chain, Sink &sink)
+{
+    chain.push_front(
+        std::make_unique<CastHandler<Event::MoveEvent, &Sink::move>>(sink));
+    chain.push_front(
+        std::make_unique<
+            CastHandler<Event::WindowResizeEvent, &Sink::windowResize>>(sink));
+    chain.push_front(
+        std::make_unique<CastHandler<Event::FrameBufferResizeEvent,
+                                     &Sink::frameBufferResize>>(sink));
+    chain.push_front(
+        std::make_unique<CastHandler<Event::KeyboardEvent, &Sink::keyboard>>(
+            sink));
+    chain.push_front(
+        std::make_unique<CastHandler<Event::MouseEvent, &Sink::mouse>>(sink));
+}
+
+// A mix close to an interactive session: mostly mouse and move events, some
+// resizes and keys.
+std::vector<std::unique_ptr<Event::Event>> makeEvents()
+{
+    std::vector<std::unique_ptr<Event::Event>> events;
+    events.reserve(Constant::eventCount);
+
+    for (size_t i{0}; i < Constant::eventCount; ++i)
+    {
+        const auto time{static_cast<Event::Event::TimeType>(i)};
+        const auto value{static_cast<int>(i)};
+        const auto position{static_cast<double>(i)};
+
+        switch (i % 8)
+        {
+        case 0:
+        case 1:
+        case 2:
+            events.push_back(std::make_unique<Event::MouseEvent>(
+                0, glm::dvec2{position, position}, 1, time, nullptr));
+            break;
+        case 3:
+        case 4:
+            events.push_back(std::make_unique<Event::MoveEvent>(
+                glm::ivec2{value, value}, glm::ivec2{0, 0}, time));
+            break;
+        case 5:
+            events.push_back(std::make_unique<Event::WindowResizeEvent>(
+                glm::ivec2{value, value}, glm::ivec2{0, 0}, time));
+            break;
+        case 6:
+            events.push_back(std::make_unique<Event::FrameBufferResizeEvent>(
+                glm::ivec2{value, value}, glm::ivec2{0, 0}, time));
+            break;
+        default:
+            events.push_back(std::make_unique<Event::KeyboardEvent>(
+                65, 1, 0, time, nullptr));
+            break;
+        }
+    }
+
+    return events;
+}
+
+double nanosecondsPerEvent(Clock::duration elapsed, size_t events)
+{
+    return static_cast<double>(
+               std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)
+                   .count()) /
+           static_cast<double>(events);
+}
+
+} // namespace Detail
+
+int main(int argc, char *argv[])
+{
+    const size_t repeatCount{
+        argc > 1 ? static_cast<size_t>(std::strtoull(argv[1], nullptr, 10))
+                 : Detail::Constant::defaultRepeatCount};
+    const auto events{Detail::makeEvents()};
+    const auto total{repeatCount * events.size()};
+
+    Detail::Sink tableSink;
+    Event::EventDispatcher dispatcher;
+    Detail::subscribe(dispatcher, tableSink);
+
+    Detail::Sink chainSink;
+    Detail::Chain chain;
+    Detail::subscribe(chain, chainSink);
+
+    auto start{Detail::Clock::now()};
+    for (size_t repeat{0}; repeat < repeatCount; ++repeat)
+    {
+        for (const auto &event : events)
+        {
+            dispatcher.dispatch(event.get());
+        }
+    }
+    const auto table{Detail::Clock::now() - start};
+
+    start = Detail::Clock::now();
+    for (size_t repeat{0}; repeat < repeatCount; ++repeat)
+    {
+        for (const auto &event : events)
+        {
+            for (auto &handler : chain)
+            {
+                if (handler->handle(event.get()))
+                {
+                    break;
+                }
+            }
+        }
+    }
+    const auto cast{Detail::Clock::now() - start};
+
+    if (tableSink.handled != total || chainSink.handled != total ||
+        tableSink.checksum != chainSink.checksum)
+    {
+        std::fprintf(stderr, "Dispatch paths disagree: %zu and %zu of %zu\n",
+                     tableSink.handled, chainSink.handled, total);
+        return EXIT_FAILURE;
+    }
+
+    std::printf("%zu events\n", total);
+    std::printf("Type table:         %.2f ns/event\n",
+                Detail::nanosecondsPerEvent(table, total));
+    std::printf("dynamic_cast chain: %.2f ns/event\n",
+                Detail::nanosecondsPerEvent(cast, total));
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,145 @@
+#include "Event/EventQueue.hpp"
+#include "Event/KeyboardEvent.hpp"
+#include "Event/MouseEvent.hpp"
+#include "Event/MoveEvent.hpp"
+#include "Event/ResizeEvent.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+// Every allocation of the process goes through the replaced operator new, so
+// the steady state of the queue can be checked to allocate nothing.
+
+namespace Detail
+{
+
+namespace Constant
+{
+
+constexpr size_t capacity{64};
+constexpr size_t roundCount{1000};
+constexpr size_t burstCount{4};
+constexpr size_t overflowCount{16};
+
+} // namespace Constant
+
+std::atomic<size_t> allocationCount{0};
+
+bool check(bool condition, const char *what);
+void pushRound(Event::EventQueue &queue, size_t round);
+size_t drain(Event::EventQueue &queue);
+
+bool check(bool condition, const char *what)
+{
+    if (!condition)
+    {
+        std::fprintf(stderr, "Failed: %s\n", what);
+    }
+
+    return condition;
+}
+
+// Bursts of moves and resizes which coalesce, then more inputs than the
+// queue holds, so the last ones are dropped.
+void pushRound(Event::EventQueue &queue, size_t round)
+{
+    const auto time{static_cast<Event::Event::TimeType>(round)};
+    const auto value{static_cast<int>(round)};
+
+    for (size_t i{0}; i < Constant::burstCount; ++i)
+    {
+        queue.push(Event::MoveEvent{glm::ivec2{value, value}, glm::ivec2{0, 0},
+                                    time});
+        queue.push(Event::WindowResizeEvent{glm::ivec2{value, value},
+                                            glm::ivec2{0, 0}, time});
+    }
+
+    for (size_t i{0}; i < Constant::capacity + Constant::overflowCount; ++i)
+    {
+        if (i % 2)
+        {
+            queue.push(Event::KeyboardEvent{65, 1, 0, time, nullptr});
+        }
+        else
+        {
+            queue.push(Event::MouseEvent{0, glm::dvec2{0.0, 0.0}, 1, time,
+                                         nullptr});
+        }
+    }
+
+    // Coalesces into nothing queued after the last input, so it is dropped.
+    queue.push(
+        Event::MoveEvent{glm::ivec2{value, value}, glm::ivec2{0, 0}, time});
+}
+
+size_t drain(Event::EventQueue &queue)
+{
+    size_t count{0};
+    while (auto event{queue.front()})
+    {
+        count += event->type() < Event::Type::Count ? 1 : 0;
+        queue.pop();
+    }
+
+    return count;
+}
+
+} // namespace Detail
+
+void *operator new(size_t size)
+{
+    Detail::allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (auto memory{std::malloc(size ? size : 1)})
+    {
+        return memory;
+    }
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void *memory) noexcept { std::free(memory); }
+
+void operator delete(void *memory, size_t) noexcept { std::free(memory); }
+
+int main()
+{
+    using Detail::Constant::capacity;
+
+    Event::EventQueue queue{capacity};
+
+    // Warm up: the first round may touch memory the later ones reuse.
+    Detail::pushRound(queue, 0);
+    Detail::drain(queue);
+
+    const auto dropped{queue.droppedCount()};
+    const auto coalesced{queue.coalescedCount()};
+    const auto before{Detail::allocationCount.load()};
+
+    auto full{true};
+    size_t drained{0};
+    for (size_t round{1}; round <= Detail::Constant::roundCount; ++round)
+    {
+        Detail::pushRound(queue, round);
+        full = full && queue.size() == capacity;
+        drained += Detail::drain(queue);
+    }
+
+    const auto allocations{Detail::allocationCount.load() - before};
+
+    auto passed{true};
+    passed &= Detail::check(allocations == 0, "no allocation after warm up");
+    passed &= Detail::check(full, "the queue is full before every drain");
+    passed &= Detail::check(drained == capacity * Detail::Constant::roundCount,
+                            "every queued event is drained");
+    passed &= Detail::check(queue.droppedCount() > dropped,
+                            "events are dropped when the queue is full");
+    passed &= Detail::check(queue.coalescedCount() > coalesced,
+                            "moves and resizes are coalesced");
+
+    std::printf("%zu allocations in %zu rounds\n", allocations,
+                Detail::Constant::roundCount);
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
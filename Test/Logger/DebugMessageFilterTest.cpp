@@ -0,0 +1,182 @@
+#include "Logger/DebugMessageFilter.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace Detail
+{
+
+namespace Constant
+{
+
+constexpr GLenum source{GL_DEBUG_SOURCE_API};
+constexpr GLenum type{GL_DEBUG_TYPE_PERFORMANCE};
+
+} // namespace Constant
+
+bool check(bool condition, const char *what);
+bool testDeduplication();
+bool testThreshold();
+bool testLoweredThreshold();
+bool testRejected();
+bool testFullTable();
+
+bool check(bool condition, const char *what)
+{
+    if (!condition)
+    {
+        std::fprintf(stderr, "Failed: %s\n", what);
+    }
+
+    return condition;
+}
+
+bool testDeduplication()
+{
+    Logger::DebugMessageFilter filter;
+    const GLenum high{GL_DEBUG_SEVERITY_HIGH};
+
+    auto passed{true};
+    passed &= check(filter.accept(Constant::source, Constant::type, 1, high),
+                    "the first occurrence is logged");
+    passed &= check(!filter.accept(Constant::source, Constant::type, 1, high),
+                    "a repeat is not logged");
+    passed &= check(!filter.accept(Constant::source, Constant::type, 1, high),
+                    "a second repeat is not logged");
+    passed &= check(filter.accept(Constant::source, GL_DEBUG_TYPE_ERROR, 1,
+                                  high),
+                    "the same id of another type is another message");
+
+    const auto counters{filter.counters()};
+    passed &= check(counters.size() == 2 && counters[0].count == 3 &&
+                        counters[0].suppressed == 2,
+                    "the repeats are counted");
+
+    std::vector<Logger::DebugMessageCounter> summaries;
+    filter.takeSummaries(summaries);
+    passed &= check(summaries.size() == 1 && summaries[0].id == 1 &&
+                        summaries[0].suppressed == 2,
+                    "the summary has the suppressed repeats");
+
+    filter.takeSummaries(summaries);
+    passed &= check(summaries.empty(), "the summary resets the repeats");
+
+    return passed;
+}
+
+bool testThreshold()
+{
+    Logger::DebugMessageFilter filter;
+    filter.setSeverityThreshold(GL_DEBUG_SEVERITY_MEDIUM);
+
+    auto passed{true};
+    passed &= check(filter.setSeverityThreshold(2, GL_DEBUG_SEVERITY_HIGH),
+                    "the threshold of an id is set");
+    passed &= check(filter.setSeverityThreshold(3, GL_DEBUG_SEVERITY_LOW),
+                    "the threshold of another id is set");
+
+    passed &= check(!filter.accept(Constant::source, Constant::type, 2,
+                                   GL_DEBUG_SEVERITY_MEDIUM),
+                    "an id below its own threshold is not logged");
+    passed &= check(filter.accept(Constant::source, Constant::type, 2,
+                                  GL_DEBUG_SEVERITY_HIGH),
+                    "an id at its own threshold is logged");
+    passed &= check(filter.accept(Constant::source, Constant::type, 3,
+                                  GL_DEBUG_SEVERITY_LOW),
+                    "an id below the default threshold uses its own one");
+    passed &= check(!filter.accept(Constant::source, Constant::type, 4,
+                                   GL_DEBUG_SEVERITY_LOW),
+                    "an id without a threshold uses the default one");
+    passed &= check(filter.accept(Constant::source, Constant::type, 4,
+                                  GL_DEBUG_SEVERITY_MEDIUM),
+                    "an id at the default threshold is logged");
+
+    return passed;
+}
+
+bool testLoweredThreshold()
+{
+    Logger::DebugMessageFilter filter;
+    const GLenum low{GL_DEBUG_SEVERITY_LOW};
+
+    auto passed{true};
+    passed &= check(filter.setSeverityThreshold(5, GL_DEBUG_SEVERITY_HIGH),
+                    "the threshold of an id is set");
+    passed &= check(!filter.accept(Constant::source, Constant::type, 5, low),
+                    "an occurrence below the threshold is not logged");
+
+    filter.setSeverityThreshold(5, low);
+    passed &= check(filter.accept(Constant::source, Constant::type, 5, low),
+                    "the first occurrence above a lowered threshold is logged");
+    passed &= check(!filter.accept(Constant::source, Constant::type, 5, low),
+                    "a repeat above a lowered threshold is not logged");
+
+    return passed;
+}
+
+bool testRejected()
+{
+    Logger::DebugMessageFilter filter;
+    const GLenum high{GL_DEBUG_SEVERITY_HIGH};
+
+    auto passed{true};
+    passed &= check(filter.accept(Constant::source, Constant::type, 6, high),
+                    "the first occurrence is accepted");
+
+    filter.rejected(Constant::source, Constant::type, 6);
+    passed &= check(filter.accept(Constant::source, Constant::type, 6, high),
+                    "the occurrence after a rejected one is accepted");
+    passed &= check(!filter.accept(Constant::source, Constant::type, 6, high),
+                    "a repeat after a logged one is not accepted");
+
+    // Nothing to give back for a message never seen.
+    filter.rejected(Constant::source, Constant::type, 7);
+    passed &= check(filter.counters().size() == 1,
+                    "rejecting an unknown message does not track it");
+
+    return passed;
+}
+
+bool testFullTable()
+{
+    Logger::DebugMessageFilter filter;
+    filter.setSeverityThreshold(GL_DEBUG_SEVERITY_MEDIUM);
+    const GLenum high{GL_DEBUG_SEVERITY_HIGH};
+
+    auto passed{true};
+    GLuint id{0};
+    while (filter.untrackedCount() == 0)
+    {
+        ++id;
+        filter.accept(Constant::source, Constant::type, id, high);
+    }
+
+    passed &= check(filter.counters().size() == id - 1,
+                    "every message before the full table is tracked");
+    passed &= check(filter.accept(Constant::source, Constant::type, id, high),
+                    "an untracked message is logged again");
+    passed &= check(!filter.accept(Constant::source, Constant::type, id,
+                                   GL_DEBUG_SEVERITY_LOW),
+                    "an untracked message below the threshold is not logged");
+    passed &= check(filter.untrackedCount() == 3,
+                    "every untracked message is counted");
+    passed &= check(!filter.accept(Constant::source, Constant::type, 1, high),
+                    "a tracked message is still deduplicated");
+
+    return passed;
+}
+
+} // namespace Detail
+
+int main()
+{
+    auto passed{true};
+    passed &= Detail::testDeduplication();
+    passed &= Detail::testThreshold();
+    passed &= Detail::testLoweredThreshold();
+    passed &= Detail::testRejected();
+    passed &= Detail::testFullTable();
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,82 @@
+#include "Model/Vertex.hpp"
+#include "Model/VertexDeduplication.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// The sharded deduplication must number the vertices exactly like the serial
+// one, so both run on the same mesh and their outputs are compared.
+
+namespace Detail
+{
+
+namespace Constant
+{
+
+constexpr size_t cornerCount{size_t{1} << 19};
+constexpr size_t positionCount{size_t{1} << 15};
+constexpr size_t hardEdgeStep{3};
+
+} // namespace Constant
+
+bool check(bool condition, const char *what);
+Model::Vertex vertexAt(size_t corner);
+
+bool check(bool condition, const char *what)
+{
+    if (!condition)
+    {
+        std::fprintf(stderr, "Failed: %s\n", what);
+    }
+
+    return condition;
+}
+
+// Every position is shared by many corners. Some positions are on a hard
+// edge and have a second normal.
+Model::Vertex vertexAt(size_t corner)
+{
+    const auto position{(corner * 7919) % Constant::positionCount};
+    const auto normal{position % Constant::hardEdgeStep ? 0 : (corner / 7) % 2};
+
+    return Model::Vertex{
+        glm::vec3{static_cast<float>(position % 256),
+                  static_cast<float>(position / 256), 0.0f},
+        glm::vec3{static_cast<float>(normal), 1.0f, 0.0f},
+        glm::vec2{static_cast<float>(position % 256) / 256.0f, 0.0f}};
+}
+
+} // namespace Detail
+
+int main()
+{
+    using Detail::Constant::cornerCount;
+
+    auto vertexAt{[](size_t corner) { return Detail::vertexAt(corner); }};
+
+    std::vector<Model::Vertex> serialVertices;
+    std::vector<unsigned int> serialIndices;
+    Model::Detail::deduplicateSerial(cornerCount, vertexAt, serialVertices,
+                                     serialIndices);
+
+    std::vector<Model::Vertex> parallelVertices;
+    std::vector<unsigned int> parallelIndices;
+    Model::Detail::deduplicateParallel(cornerCount, vertexAt, parallelVertices,
+                                       parallelIndices);
+
+    auto passed{true};
+    passed &= Detail::check(serialIndices.size() == cornerCount,
+                            "every corner has an index");
+    passed &= Detail::check(serialVertices.size() < cornerCount / 4,
+                            "the mesh repeats its vertices");
+    passed &= Detail::check(parallelVertices == serialVertices,
+                            "both paths give the same vertices");
+    passed &= Detail::check(parallelIndices == serialIndices,
+                            "both paths give the same indices");
+
+    std::printf("%zu corners, %zu vertices\n", cornerCount,
+                serialVertices.size());
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -30,5 +30,6 @@ if (WIN32)
     copy_file(${glfw3_DIR}/../../../bin/glfw3.dll)
 endif()
 
+copy_directory_content(${${PROJECT_NAME}_SOURCE_DIR}/CameraPath /CameraPath)
 copy_directory_content(${${PROJECT_NAME}_SOURCE_DIR}/Shader /Shader)
 copy_directory_content(${CMAKE_SOURCE_DIR}/resources /resources)